@@ -34,8 +34,9 @@ bool TWPublicKeyIsCompressed(struct TWPublicKey *_Nonnull pk);
 TW_EXPORT_PROPERTY
 struct TWPublicKey *_Nonnull TWPublicKeyCompressed(struct TWPublicKey *_Nonnull from);
 
+/// Returns the uncompressed key, or null if the key is not a point on its curve.
 TW_EXPORT_PROPERTY
-struct TWPublicKey *_Nonnull TWPublicKeyUncompressed(struct TWPublicKey *_Nonnull from);
+struct TWPublicKey *_Nullable TWPublicKeyUncompressed(struct TWPublicKey *_Nonnull from);
 
 TW_EXPORT_PROPERTY
 TWData *_Nonnull TWPublicKeyData(struct TWPublicKey *_Nonnull pk);
@@ -0,0 +1,153 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "AddressSet.h"
+
+#include "AnyAddress.h"
+#include "HDWallet.h"
+#include "Hash.h"
+#include "Parallel.h"
+#include "XXHash64.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace TW;
+
+namespace {
+
+const size_t minCapacity = 16;
+
+Data payloadForPublicKey(TWCoinType coin, const PublicKey& publicKey) {
+    auto payload = AnyAddress::createWithPublicKey(publicKey, coin).data;
+    if (payload.empty()) {
+        throw std::invalid_argument("Address payload not available for this coin");
+    }
+    return payload;
+}
+
+} // namespace
+
+uint64_t AddressSet::tag(TWCoinType coin, const byte* payload, size_t size) {
+    const auto hash = XXHash64::hash(payload, size, static_cast<uint64_t>(coin));
+    // 0 marks an empty slot
+    return hash == 0 ? 1 : hash;
+}
+
+size_t AddressSet::find(uint64_t tag, TWCoinType coin, const byte* payload, size_t size) const {
+    const auto mask = tags.size() - 1;
+    for (auto index = static_cast<size_t>(tag) & mask;; index = (index + 1) & mask) {
+        if (tags[index] == 0) {
+            return index;
+        }
+        if (tags[index] == tag) {
+            const auto& entry = entries[index];
+            if (entry.coin == static_cast<uint32_t>(coin) && entry.size == size &&
+                std::memcmp(payloads.data() + entry.offset, payload, size) == 0) {
+                return index;
+            }
+        }
+    }
+}
+
+void AddressSet::rehash(size_t capacity) {
+    auto oldTags = std::move(tags);
+    auto oldEntries = std::move(entries);
+    tags.assign(capacity, 0);
+    entries.assign(capacity, Entry{});
+
+    const auto mask = capacity - 1;
+    for (size_t i = 0; i < oldTags.size(); ++i) {
+        if (oldTags[i] == 0) {
+            continue;
+        }
+        auto index = static_cast<size_t>(oldTags[i]) & mask;
+        while (tags[index] != 0) {
+            index = (index + 1) & mask;
+        }
+        tags[index] = oldTags[i];
+        entries[index] = oldEntries[i];
+    }
+}
+
+void AddressSet::reserve(size_t count) {
+    // keep the load factor at or below 1/2
+    auto capacity = std::max(minCapacity, tags.size());
+    while (capacity < count * 2) {
+        capacity *= 2;
+    }
+    if (capacity != tags.size()) {
+        rehash(capacity);
+    }
+}
+
+bool AddressSet::insert(TWCoinType coin, const byte* payload, size_t size) {
+    reserve(count + 1);
+    const auto hash = tag(coin, payload, size);
+    const auto index = find(hash, coin, payload, size);
+    if (tags[index] != 0) {
+        return false;
+    }
+    tags[index] = hash;
+    entries[index] = Entry{static_cast<uint32_t>(coin), static_cast<uint32_t>(payloads.size()), static_cast<uint32_t>(size)};
+    payloads.insert(payloads.end(), payload, payload + size);
+    ++count;
+    return true;
+}
+
+bool AddressSet::insert(TWCoinType coin, const PublicKey& publicKey) {
+    return insert(coin, payloadForPublicKey(coin, publicKey));
+}
+
+size_t AddressSet::insertRange(TWCoinType coin, const std::string& extendedPublicKey, uint32_t change, uint32_t first, uint32_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    const auto keys = HDWallet::getPublicKeysFromExtended(extendedPublicKey, coin, change, first, count);
+    if (keys.empty()) {
+        throw std::invalid_argument("Invalid extended public key");
+    }
+
+    std::vector<Data> addresses(keys.size());
+    parallelFor(keys.size(), [&](size_t i) {
+        addresses[i] = payloadForPublicKey(coin, keys[i]);
+    });
+
+    reserve(this->count + addresses.size());
+    size_t added = 0;
+    for (const auto& payload : addresses) {
+        added += insert(coin, payload) ? 1 : 0;
+    }
+    return added;
+}
+
+bool AddressSet::contains(TWCoinType coin, const byte* payload, size_t size) const {
+    if (count == 0) {
+        return false;
+    }
+    return tags[find(tag(coin, payload, size), coin, payload, size)] != 0;
+}
+
+bool AddressSet::containsScript(TWCoinType coin, const Bitcoin::Script& script) const {
+    const auto match = script.classify();
+    switch (match.type) {
+    case Bitcoin::ScriptType::payToPublicKeyHash:
+    case Bitcoin::ScriptType::payToWitnessPublicKeyHash:
+    case Bitcoin::ScriptType::payToScriptHash:
+    case Bitcoin::ScriptType::payToWitnessScriptHash:
+    case Bitcoin::ScriptType::witnessProgram:
+        return contains(coin, match.data.data, match.data.size);
+    case Bitcoin::ScriptType::payToPublicKey: {
+        const auto keyHash = Hash::sha256ripemd(match.data.data, match.data.size);
+        return contains(coin, keyHash);
+    }
+    case Bitcoin::ScriptType::multisig:
+    case Bitcoin::ScriptType::nonStandard:
+        break;
+    }
+    return false;
+}
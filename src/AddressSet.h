@@ -0,0 +1,77 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+#include "PublicKey.h"
+#include "Bitcoin/Script.h"
+
+#include <TrustWalletCore/TWCoinType.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TW {
+
+/// Set of owned addresses, keyed by coin and decoded payload: the key hash, script hash or witness program
+/// for Bitcoin-style coins, the account bytes for the others (the same bytes as AnyAddress::data).
+/// Lookups hash the payload and probe a flat open-addressing table, without building address strings.
+class AddressSet {
+public:
+    /// Number of addresses in the set.
+    size_t size() const { return count; }
+
+    /// Adds a decoded address payload; returns false if it was already present.
+    bool insert(TWCoinType coin, const byte* payload, size_t size);
+    bool insert(TWCoinType coin, const Data& payload) { return insert(coin, payload.data(), payload.size()); }
+
+    /// Adds the address of a public key; returns false if it was already present.
+    /// Throws std::invalid_argument if the coin's addresses have no payload accessor.
+    bool insert(TWCoinType coin, const PublicKey& publicKey);
+
+    /// Adds the addresses at change/first ... change/(first + count - 1) below an extended public key.
+    /// Returns the number of addresses added, or throws std::invalid_argument if the extended key is invalid or an
+    /// index is hardened.
+    size_t insertRange(TWCoinType coin, const std::string& extendedPublicKey, uint32_t change, uint32_t first, uint32_t count);
+
+    /// Whether a decoded address payload is in the set.
+    bool contains(TWCoinType coin, const byte* payload, size_t size) const;
+    bool contains(TWCoinType coin, const Data& payload) const { return contains(coin, payload.data(), payload.size()); }
+
+    /// Whether an output script pays to an address in the set.
+    /// P2PKH, P2WPKH and P2PK scripts are matched by key hash, P2SH by script hash, other witness programs by program.
+    bool containsScript(TWCoinType coin, const Bitcoin::Script& script) const;
+
+    /// Reserves room for count addresses, to avoid rehashing while populating.
+    void reserve(size_t count);
+
+private:
+    struct Entry {
+        uint32_t coin;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    /// Hash of each slot, 0 for an empty slot; a dense array, so probing mostly stays within one cache line.
+    std::vector<uint64_t> tags;
+
+    /// Coin and payload location of each occupied slot.
+    std::vector<Entry> entries;
+
+    /// Payload bytes of all entries.
+    Data payloads;
+
+    size_t count = 0;
+
+    static uint64_t tag(TWCoinType coin, const byte* payload, size_t size);
+    size_t find(uint64_t tag, TWCoinType coin, const byte* payload, size_t size) const;
+    void rehash(size_t capacity);
+};
+
+} // namespace TW
@@ -7,7 +7,9 @@
 #include "Signer.h"
 #include "Address.h"
 #include "BaseTransaction.h"
+#include "../Hash.h"
 #include "../HexCoding.h"
+#include "../Parallel.h"
 
 #include <google/protobuf/util/json_util.h>
 
@@ -15,6 +17,7 @@ using namespace TW;
 using namespace TW::Algorand;
 
 const Data TRANSACTION_TAG = {84, 88};
+const Data TRANSACTION_GROUP_TAG = {84, 71};
 const std::string TRANSACTION_PAY = "pay";
 const std::string ASSET_TRANSACTION = "axfer";
 
@@ -78,3 +81,84 @@ Data Signer::sign(const PrivateKey& privateKey, const BaseTransaction& transacti
     auto signature = privateKey.sign(data, TWCurveED25519);
     return Data(signature.begin(), signature.end());
 }
+
+std::vector<Data> Signer::signBatch(const PrivateKey& privateKey, const TransactionTemplate& txTemplate,
+                                    const std::vector<BatchTransfer>& transfers, size_t groupSize) {
+    if (groupSize > maxGroupSize) {
+        throw std::invalid_argument("Group size exceeds maximum");
+    }
+    if (!(Address(privateKey.getPublicKey(TWPublicKeyTypeED25519)) == txTemplate.from)) {
+        throw std::invalid_argument("Template sender does not match private key");
+    }
+
+    auto signedTransactions = std::vector<Data>(transfers.size());
+    if (groupSize == 0) {
+        parallelFor(transfers.size(), [&](size_t index) {
+            signedTransactions[index] = signEncoded(privateKey, txTemplate.serialize(transfers[index], {}));
+        });
+        return signedTransactions;
+    }
+
+    // Each group needs the IDs of all its transactions before any of them can be signed, so groups are the unit of work
+    const auto groupCount = (transfers.size() + groupSize - 1) / groupSize;
+    parallelFor(groupCount, [&](size_t group) {
+        const auto begin = group * groupSize;
+        const auto end = std::min(begin + groupSize, transfers.size());
+
+        auto ids = std::vector<Data>();
+        ids.reserve(end - begin);
+        for (auto index = begin; index < end; ++index) {
+            ids.push_back(transactionId(txTemplate.serialize(transfers[index], {})));
+        }
+        const auto id = groupId(ids);
+        for (auto index = begin; index < end; ++index) {
+            signedTransactions[index] = signEncoded(privateKey, txTemplate.serialize(transfers[index], id));
+        }
+    });
+    return signedTransactions;
+}
+
+Data Signer::transactionId(const Data& transaction) {
+    Data data;
+    data.reserve(TRANSACTION_TAG.size() + transaction.size());
+    append(data, TRANSACTION_TAG);
+    append(data, transaction);
+    return Hash::sha512_256(data);
+}
+
+Data Signer::groupId(const std::vector<Data>& transactionIds) {
+    /* Group is encoded with msgpack:
+    {
+        "txlist": [<transaction id>, ...]
+    }
+    */
+    Data data;
+    append(data, TRANSACTION_GROUP_TAG);
+    // encode map length
+    data.push_back(0x80 + 1);
+    encodeString("txlist", data);
+    // fixarray, a group holds at most 16 transactions
+    data.push_back(static_cast<uint8_t>(0x90 + transactionIds.size()));
+    for (const auto& id : transactionIds) {
+        encodeBytes(id, data);
+    }
+    return Hash::sha512_256(data);
+}
+
+Data Signer::signEncoded(const PrivateKey& privateKey, const Data& transaction) {
+    Data data;
+    data.reserve(TRANSACTION_TAG.size() + transaction.size());
+    append(data, TRANSACTION_TAG);
+    append(data, transaction);
+    const auto signature = privateKey.sign(data, TWCurveED25519);
+
+    // same layout as BaseTransaction::serialize(signature)
+    Data encoded;
+    encoded.reserve(transaction.size() + signature.size() + 16);
+    encoded.push_back(0x80 + 2);
+    encodeString("sig", encoded);
+    encodeBytes(signature, encoded);
+    encodeString("txn", encoded);
+    append(encoded, transaction);
+    return encoded;
+}
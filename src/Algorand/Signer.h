@@ -8,11 +8,14 @@
 
 #include "AssetTransfer.h"
 #include "OptInAssetTransaction.h"
+#include "TransactionTemplate.h"
 #include "Transfer.h"
 
 #include "../Data.h"
 #include "../PrivateKey.h"
 
+#include <vector>
+
 namespace TW::Algorand {
 
 /// Helper class that performs Algorand transaction signing.
@@ -28,6 +31,27 @@ class Signer {
 
     /// Signs the given transaction.
     static Data sign(const PrivateKey& privateKey, const BaseTransaction& transaction) noexcept;
+
+    /// Maximum number of transactions in an atomic group.
+    static const size_t maxGroupSize = 16;
+
+    /// Signs transfers that share the sender and header fields of txTemplate, in parallel.
+    /// When groupSize is not zero, consecutive transactions are assigned atomic group IDs in groups of at most groupSize.
+    ///
+    /// \returns the signed and encoded transactions, in the order of transfers.
+    /// \throws std::invalid_argument if the template sender does not match the private key or groupSize exceeds maxGroupSize.
+    static std::vector<Data> signBatch(const PrivateKey& privateKey, const TransactionTemplate& txTemplate,
+                                       const std::vector<BatchTransfer>& transfers, size_t groupSize);
+
+    /// Computes the ID of an encoded transaction: SHA512/256 of "TX" followed by the transaction.
+    static Data transactionId(const Data& transaction);
+
+    /// Computes the atomic group ID for the given transaction IDs: SHA512/256 of "TG" followed by {"txlist": [ids]}.
+    static Data groupId(const std::vector<Data>& transactionIds);
+
+  private:
+    /// Signs an encoded transaction and wraps it with its signature.
+    static Data signEncoded(const PrivateKey& privateKey, const Data& transaction);
 };
 
 } // namespace TW::Algorand
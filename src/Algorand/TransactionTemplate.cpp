@@ -0,0 +1,92 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "TransactionTemplate.h"
+#include "BinaryCoding.h"
+
+using namespace TW;
+using namespace TW::Algorand;
+
+static const std::string TRANSACTION_PAY = "pay";
+static const std::string ASSET_TRANSACTION = "axfer";
+
+static void encodeAddress(const Address& address, Data& data) {
+    // bin 8 with the 32-byte public key
+    data.push_back(static_cast<uint8_t>(0xc4));
+    data.push_back(static_cast<uint8_t>(address.bytes.size()));
+    data.insert(data.end(), address.bytes.begin(), address.bytes.end());
+}
+
+TransactionTemplate::TransactionTemplate(const Address& from, uint64_t fee, uint64_t firstRound, uint64_t lastRound,
+                                         const Data& note, const std::string& genesisId, const Data& genesisHash)
+    : from(from), fee(fee), firstRound(firstRound), lastRound(lastRound), note(note), genesisId(genesisId), genesisHash(genesisHash) {
+    encodeString("fee", encodedFeeToGenesisHash);
+    encodeNumber(fee, encodedFeeToGenesisHash);
+    encodeString("fv", encodedFeeToGenesisHash);
+    encodeNumber(firstRound, encodedFeeToGenesisHash);
+    encodeString("gen", encodedFeeToGenesisHash);
+    encodeString(genesisId, encodedFeeToGenesisHash);
+    encodeString("gh", encodedFeeToGenesisHash);
+    encodeBytes(genesisHash, encodedFeeToGenesisHash);
+
+    encodeString("lv", encodedLastRoundAndNote);
+    encodeNumber(lastRound, encodedLastRoundAndNote);
+    if (!note.empty()) {
+        encodeString("note", encodedLastRoundAndNote);
+        encodeBytes(note, encodedLastRoundAndNote);
+    }
+
+    encodeString("snd", encodedSender);
+    encodeAddress(from, encodedSender);
+}
+
+Data TransactionTemplate::serialize(const BatchTransfer& transfer, const Data& group) const {
+    const bool isAsset = transfer.assetId != 0;
+
+    Data data;
+    data.reserve(96 + encodedFeeToGenesisHash.size() + encodedLastRoundAndNote.size() + encodedSender.size() + group.size());
+
+    // encode map length, fields are sorted by name
+    uint8_t size = isAsset ? 10 : 9;
+    if (!note.empty()) {
+        size += 1;
+    }
+    if (!group.empty()) {
+        size += 1;
+    }
+    data.push_back(0x80 + size);
+
+    if (isAsset) {
+        encodeString("aamt", data);
+        encodeNumber(transfer.amount, data);
+        encodeString("arcv", data);
+        encodeAddress(transfer.to, data);
+    } else {
+        encodeString("amt", data);
+        encodeNumber(transfer.amount, data);
+    }
+
+    append(data, encodedFeeToGenesisHash);
+    if (!group.empty()) {
+        encodeString("grp", data);
+        encodeBytes(group, data);
+    }
+    append(data, encodedLastRoundAndNote);
+
+    if (!isAsset) {
+        encodeString("rcv", data);
+        encodeAddress(transfer.to, data);
+    }
+    append(data, encodedSender);
+
+    encodeString("type", data);
+    encodeString(isAsset ? ASSET_TRANSACTION : TRANSACTION_PAY, data);
+    if (isAsset) {
+        encodeString("xaid", data);
+        encodeNumber(transfer.assetId, data);
+    }
+    return data;
+}
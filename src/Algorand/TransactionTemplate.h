@@ -0,0 +1,51 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Address.h"
+#include "../Data.h"
+
+#include <string>
+
+namespace TW::Algorand {
+
+/// A single payment of a batch: an ALGO transfer when assetId is 0, an asset (ASA) transfer otherwise.
+struct BatchTransfer {
+    Address to;
+    uint64_t amount;
+    uint64_t assetId;
+};
+
+/// Header fields shared by all transactions of a batch (sender, fee, validity rounds, note and genesis),
+/// msgpack-encoded once so that each transaction only encodes its recipient, amount and optional group.
+class TransactionTemplate {
+  public:
+    Address from;
+    uint64_t fee;
+    uint64_t firstRound;
+    uint64_t lastRound;
+    Data note;
+    std::string genesisId;
+    Data genesisHash;
+
+    TransactionTemplate(const Address& from, uint64_t fee, uint64_t firstRound, uint64_t lastRound,
+                        const Data& note, const std::string& genesisId, const Data& genesisHash);
+
+    /// Encodes the transaction for a transfer; identical to Transfer/AssetTransfer::serialize when group is empty.
+    /// \param group 32-byte atomic group ID, or empty for a standalone transaction
+    Data serialize(const BatchTransfer& transfer, const Data& group) const;
+
+  private:
+    /// Encoded "fee", "fv", "gen" and "gh" entries
+    Data encodedFeeToGenesisHash;
+    /// Encoded "lv" and optional "note" entries
+    Data encodedLastRoundAndNote;
+    /// Encoded "snd" entry
+    Data encodedSender;
+};
+
+} // namespace TW::Algorand
@@ -0,0 +1,329 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "AnyAddress.h"
+
+#include "Bitcoin/Address.h"
+#include "Bitcoin/CashAddress.h"
+#include "Bitcoin/SegwitAddress.h"
+#include "Cosmos/Address.h"
+#include "Decred/Address.h"
+#include "Ethereum/Address.h"
+#include "Kusama/Address.h"
+#include "Polkadot/Address.h"
+#include "Zcash/TAddress.h"
+#include "Zilliqa/Address.h"
+#include "Cardano/AddressV3.h"
+#include "NEO/Address.h"
+#include "Nano/Address.h"
+#include "Elrond/Address.h"
+#include "NEAR/Address.h"
+
+#include "Coin.h"
+#include "HexCoding.h"
+
+#include <TrustWalletCore/TWHRP.h>
+
+using namespace TW;
+
+namespace {
+
+/// Extracts the underlying data of an address that is known to be valid for the coin.
+Data decodeData(TWCoinType coin, const std::string& string) {
+    Data data;
+    switch (coin) {
+    case TWCoinTypeBinance:
+    case TWCoinTypeCosmos:
+    case TWCoinTypeKava:
+    case TWCoinTypeTerra:
+    case TWCoinTypeBandChain:
+    case TWCoinTypeTHORChain:
+    case TWCoinTypeBluzelle:
+    case TWCoinTypeIoTeX: {
+        Cosmos::Address addr;
+        if (!Cosmos::Address::decode(string, addr)) {
+            break;
+        }
+        data = addr.getKeyHash();
+        break;
+    }
+
+    case TWCoinTypeBitcoin:
+    case TWCoinTypeDigiByte:
+    case TWCoinTypeGroestlcoin:
+    case TWCoinTypeLitecoin:
+    case TWCoinTypeViacoin: {
+        auto decoded = Bitcoin::SegwitAddress::decode(string);
+        if (!std::get<2>(decoded)) {
+            break;
+        }
+        data = std::get<0>(decoded).witnessProgram;
+        break;
+    }
+
+    case TWCoinTypeBitcoinCash: {
+        const auto payload = Bitcoin::CashAddress(string).payload();
+        data = Data(payload.begin() + 1, payload.end());
+        break;
+    }
+
+    case TWCoinTypeDash:
+    case TWCoinTypeDogecoin:
+    case TWCoinTypeMonacoin:
+    case TWCoinTypeQtum:
+    case TWCoinTypeRavencoin:
+    case TWCoinTypeZcoin: {
+        auto addr = Bitcoin::Address(string);
+        data = Data(addr.bytes.begin() + 1, addr.bytes.end());
+        break;
+    }
+
+    case TWCoinTypeDecred: {
+        auto addr = Decred::Address(string);
+        data = Data(addr.bytes.begin() + 2, addr.bytes.end());
+        break;
+    }
+
+    case TWCoinTypeZcash:
+    case TWCoinTypeZelcash: {
+        auto addr = Zcash::TAddress(string);
+        data = Data(addr.bytes.begin() + 2, addr.bytes.end());
+        break;
+    }
+
+    case TWCoinTypeCallisto:
+    case TWCoinTypeEthereum:
+    case TWCoinTypeEthereumClassic:
+    case TWCoinTypeGoChain:
+    case TWCoinTypePOANetwork:
+    case TWCoinTypeThunderToken:
+    case TWCoinTypeTomoChain:
+    case TWCoinTypeVeChain:
+    case TWCoinTypeTheta:
+    case TWCoinTypeWanchain:
+    case TWCoinTypeAion:
+    case TWCoinTypeSmartChainLegacy:
+    case TWCoinTypeSmartChain:
+    case TWCoinTypePolygon:
+    case TWCoinTypeOptimism:
+    case TWCoinTypeArbitrum:
+    case TWCoinTypeECOChain:
+    case TWCoinTypeXDai:
+    case TWCoinTypeAvalancheCChain:
+    case TWCoinTypeFantom:
+        data = parse_hex(string);
+        break;
+
+    case TWCoinTypeNano: {
+        auto addr = Nano::Address(string);
+        data = Data(addr.bytes.begin(), addr.bytes.end());
+        break;
+    }
+
+    case TWCoinTypeZilliqa: {
+        Zilliqa::Address addr;
+        if (!Zilliqa::Address::decode(string, addr)) {
+            break;
+        }
+        // data in Zilliqa is a checksummed string without 0x
+        auto str = Zilliqa::checksum(addr.getKeyHash());
+        data = Data(str.begin(), str.end());
+        break;
+    }
+
+    case TWCoinTypeKusama: {
+        auto addr = Kusama::Address(string);
+        data = Data(addr.bytes.begin() + 1, addr.bytes.end());
+        break;
+    }
+
+    case TWCoinTypePolkadot: {
+        auto addr = Polkadot::Address(string);
+        data = Data(addr.bytes.begin() + 1, addr.bytes.end());
+        break;
+    }
+
+    case TWCoinTypeCardano: {
+        auto addr = Cardano::AddressV3(string);
+        data = addr.data();
+        break;
+    }
+
+    case TWCoinTypeNEO: {
+        auto addr = NEO::Address(string);
+        data = Data(addr.bytes.begin(), addr.bytes.end());
+        break;
+    }
+
+    case TWCoinTypeElrond: {
+        Elrond::Address addr;
+        if (Elrond::Address::decode(string, addr)) {
+            data = addr.getKeyHash();
+        }
+        
+        break;
+    }
+
+    case TWCoinTypeNEAR: {
+        auto addr = NEAR::Address(string);
+        data = Data(addr.bytes.begin(), addr.bytes.end());
+        break;
+    }
+
+    default: break;
+    }
+    return data;
+}
+
+/// Underlying data of a valid address, empty for the kinds decodeData can't handle (e.g. Qtum segwit).
+Data dataForAddress(TWCoinType coin, const std::string& string) {
+    try {
+        return decodeData(coin, string);
+    } catch (const std::exception&) {
+        return {};
+    }
+}
+
+/// Coin-specific decoding, with the coin's parameters looked up once.
+/// Coins with a dedicated path validate, normalize and extract the data from a single parse of the string;
+/// the others go through the coin entry, then decode once more for the data.
+class Decoder {
+public:
+    explicit Decoder(TWCoinType coin)
+        : coin(coin), hrp(hrpString(coin)) {}
+
+    std::optional<AnyAddress> decode(const std::string& string) const {
+        switch (coin) {
+        case TWCoinTypeCallisto:
+        case TWCoinTypeEthereum:
+        case TWCoinTypeEthereumClassic:
+        case TWCoinTypeGoChain:
+        case TWCoinTypePOANetwork:
+        case TWCoinTypeThunderToken:
+        case TWCoinTypeTomoChain:
+        case TWCoinTypeSmartChainLegacy:
+        case TWCoinTypeSmartChain:
+        case TWCoinTypeWanchain:
+        case TWCoinTypePolygon:
+        case TWCoinTypeOptimism:
+        case TWCoinTypeArbitrum:
+        case TWCoinTypeECOChain:
+        case TWCoinTypeAvalancheCChain:
+        case TWCoinTypeXDai:
+        case TWCoinTypeFantom:
+        case TWCoinTypeTheta:
+        case TWCoinTypeVeChain:
+            return decodeEthereum(string);
+
+        case TWCoinTypeBitcoin:
+        case TWCoinTypeDigiByte:
+        case TWCoinTypeLitecoin:
+        case TWCoinTypeViacoin:
+        case TWCoinTypeGroestlcoin:
+            return decodeSegwit(string);
+
+        case TWCoinTypeBitcoinCash:
+            return decodeCashAddress(string);
+
+        case TWCoinTypeCosmos:
+        case TWCoinTypeKava:
+        case TWCoinTypeTerra:
+        case TWCoinTypeBandChain:
+        case TWCoinTypeBluzelle:
+            return decodeCosmos(string);
+
+        default:
+            return decodeGeneric(string);
+        }
+    }
+
+private:
+    TWCoinType coin;
+    std::string hrp;
+
+    static std::string hrpString(TWCoinType coin) {
+        const auto string = stringForHRP(TW::hrp(coin));
+        return string == nullptr ? "" : string;
+    }
+
+    AnyAddress make(std::string address, Data data) const {
+        return AnyAddress{std::move(address), coin, std::move(data)};
+    }
+
+    /// Hex parsed once, normalized with the EIP55 checksum.
+    std::optional<AnyAddress> decodeEthereum(const std::string& string) const {
+        if (string.size() != 42 || string[0] != '0' || string[1] != 'x') {
+            return std::nullopt;
+        }
+        auto data = parse_hex(string);
+        if (!Ethereum::Address::isValid(data)) {
+            return std::nullopt;
+        }
+        auto normalized = Ethereum::Address(data).string();
+        return make(std::move(normalized), std::move(data));
+    }
+
+    /// Segwit address with the coin's hrp (decoded once), or a legacy Base58 address without data.
+    std::optional<AnyAddress> decodeSegwit(const std::string& string) const {
+        auto decoded = Bitcoin::SegwitAddress::decode(string);
+        if (std::get<2>(decoded) && std::get<1>(decoded) == hrp) {
+            return make(string, std::move(std::get<0>(decoded).witnessProgram));
+        }
+        return decodeGeneric(string);
+    }
+
+    /// CashAddr (decoded once), normalized with the bitcoincash: prefix, or a legacy Base58 address without data.
+    std::optional<AnyAddress> decodeCashAddress(const std::string& string) const {
+        std::optional<Bitcoin::CashAddress> address;
+        try {
+            address.emplace(string);
+        } catch (const std::invalid_argument&) {
+            return decodeGeneric(string);
+        }
+        const auto payload = address->payload();
+        return make(address->string(), Data(payload.begin() + 1, payload.end()));
+    }
+
+    /// Bech32 decoded once, with the coin's hrp.
+    std::optional<AnyAddress> decodeCosmos(const std::string& string) const {
+        Cosmos::Address address;
+        if (!Bech32Address::decode(string, address, hrp)) {
+            return std::nullopt;
+        }
+        return make(string, address.getKeyHash());
+    }
+
+    std::optional<AnyAddress> decodeGeneric(const std::string& string) const {
+        auto normalized = TW::normalizeAddress(coin, string);
+        if (normalized.empty()) {
+            return std::nullopt;
+        }
+        auto data = dataForAddress(coin, normalized);
+        return make(std::move(normalized), std::move(data));
+    }
+};
+
+} // namespace
+
+std::optional<AnyAddress> AnyAddress::createWithString(const std::string& string, TWCoinType coin) {
+    return Decoder(coin).decode(string);
+}
+
+std::vector<std::optional<AnyAddress>> AnyAddress::createWithStrings(const std::vector<std::string>& strings, TWCoinType coin) {
+    const auto decoder = Decoder(coin);
+    std::vector<std::optional<AnyAddress>> addresses;
+    addresses.reserve(strings.size());
+    for (const auto& string : strings) {
+        addresses.push_back(decoder.decode(string));
+    }
+    return addresses;
+}
+
+AnyAddress AnyAddress::createWithPublicKey(const PublicKey& publicKey, TWCoinType coin) {
+    auto address = TW::deriveAddress(coin, publicKey);
+    auto data = dataForAddress(coin, address);
+    return AnyAddress{std::move(address), coin, std::move(data)};
+}
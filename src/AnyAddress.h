@@ -0,0 +1,44 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+#include "PublicKey.h"
+
+#include <TrustWalletCore/TWCoinType.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace TW {
+
+/// Address of any supported coin, validated, normalized and decoded once at creation.
+class AnyAddress {
+public:
+    /// Normalized string representation.
+    std::string address;
+
+    TWCoinType coin;
+
+    /// Underlying data (public key or key hash), empty for coins or address kinds that don't expose it.
+    Data data;
+
+    /// Decodes an address string; returns nullopt if it is not a valid address for the coin.
+    static std::optional<AnyAddress> createWithString(const std::string& string, TWCoinType coin);
+
+    /// Decodes a list of address strings of the same coin, looking up the coin's parameters only once.
+    /// Invalid addresses yield nullopt at their position.
+    static std::vector<std::optional<AnyAddress>> createWithStrings(const std::vector<std::string>& strings, TWCoinType coin);
+
+    /// Derives the address of a public key.
+    static AnyAddress createWithPublicKey(const PublicKey& publicKey, TWCoinType coin);
+
+    bool operator==(const AnyAddress& rhs) const { return coin == rhs.coin && address == rhs.address; }
+};
+
+} // namespace TW
@@ -140,6 +140,66 @@ Data Base58::decode(const char* begin, const char* end) const {
     return result;
 }
 
+bool Base58::decode(const char* begin, const char* end, byte* result, std::size_t size) const {
+    auto it = begin;
+
+    // Skip leading spaces.
+    it = std::find_if_not(it, end, std::isspace);
+
+    // Skip and count leading zeros.
+    std::size_t zeroes = 0;
+    while (it != end && *it == digits[0]) {
+        zeroes += 1;
+        it += 1;
+    }
+    if (zeroes > size) {
+        return false;
+    }
+
+    // Accumulate the big-endian base256 value at the end of the output buffer.
+    std::fill(result, result + size, 0);
+    std::size_t length = 0;
+    while (it != end && !std::isspace(*it)) {
+        if (static_cast<unsigned char>(*it) >= 128) {
+            // Invalid b58 character
+            return false;
+        }
+
+        // Decode base58 character
+        int carry = characterMap[static_cast<unsigned char>(*it)];
+        if (carry == -1) {
+            // Invalid b58 character
+            return false;
+        }
+
+        std::size_t i = 0;
+        for (; (carry != 0 || i < length) && i < size; ++i) {
+            carry += 58 * result[size - 1 - i];
+            result[size - 1 - i] = static_cast<uint8_t>(carry % 256);
+            carry /= 256;
+        }
+        if (carry != 0) {
+            // Value does not fit
+            return false;
+        }
+        length = i;
+        it += 1;
+    }
+
+    // Skip trailing spaces.
+    it = std::find_if_not(it, end, std::isspace);
+    if (it != end) {
+        // Extra charaters at the end
+        return false;
+    }
+
+    // Leading zero characters must account for exactly the bytes the value leaves unused.
+    while (length > 0 && result[size - length] == 0) {
+        length -= 1;
+    }
+    return zeroes + length == size;
+}
+
 std::string Base58::encodeCheck(const byte* begin, const byte* end, Hash::Hasher hasher) const {
     // add 4-byte hash check to the end
     Data dataWithCheck(begin, end);
@@ -49,6 +49,10 @@ class Base58 {
     /// Decodes a base 58 string into `result`, returns `false` on failure.
     Data decode(const char* begin, const char* end) const;
 
+    /// Decodes a base 58 string into exactly `size` bytes at `result`, without allocating.
+    /// Returns `false` on failure or if the decoded data is not exactly `size` bytes long.
+    bool decode(const char* begin, const char* end, byte* result, std::size_t size) const;
+
     /// Encodes data as a base 58 string with a checksum.
     template <typename T>
     std::string encodeCheck(const T& data, Hash::Hasher hasher = Hash::sha256d) const {
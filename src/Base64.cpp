@@ -6,75 +6,263 @@
 
 #include "Base64.h"
 
-#include <boost/algorithm/string.hpp>
-#include <boost/archive/iterators/base64_from_binary.hpp>
-#include <boost/archive/iterators/binary_from_base64.hpp>
-#include <boost/archive/iterators/transform_width.hpp>
+#include <array>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TW_BASE64_AVX2 1
+#include <immintrin.h>
+#endif
 
 namespace TW::Base64 {
 
 using namespace TW;
 using namespace std;
 
-Data decode(const string& val) {
-    using namespace boost::archive::iterators;
-    using It = transform_width<binary_from_base64<string::const_iterator>, 8, 6>;
-    return boost::algorithm::trim_right_copy_if(Data(It(begin(val)), It(end(val))),
-                                                [](char c) { return c == '\0'; });
+namespace {
+
+constexpr char standardAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr char urlAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+constexpr byte invalidValue = 0xff;
+
+/// Maps characters to their 6-bit values, invalidValue for anything else.
+/// The Base64Url table accepts both alphabets.
+constexpr array<byte, 256> decodeTable(bool url) {
+    array<byte, 256> table{};
+    for (auto& value : table) {
+        value = invalidValue;
+    }
+    for (byte i = 0; i < 64; ++i) {
+        table[static_cast<byte>(standardAlphabet[i])] = i;
+    }
+    if (url) {
+        table['-'] = 62;
+        table['_'] = 63;
+    }
+    return table;
 }
 
-string encode(const Data& val) {
-    using namespace boost::archive::iterators;
-    using It = base64_from_binary<transform_width<Data::const_iterator, 6, 8>>;
-    auto encoded = string(It(begin(val)), It(end(val)));
-    return encoded.append((3 - val.size() % 3) % 3, '=');
+constexpr auto standardTable = decodeTable(false);
+constexpr auto urlTable = decodeTable(true);
+
+[[noreturn]] void invalidString() {
+    throw invalid_argument("Invalid base64 string");
 }
 
-/// Convert from Base64Url format to regular
-void convertFromBase64Url(string& b) {
-    // '-' and '_' (Base64URL format) are changed to '+' and '/'
-    // in-place replace
-    size_t n = b.length();
-    char* start = b.data();
-    char* end = start + n;
-    for(auto p = start; p < end; ++p) {
-        if (*p == '-') { *p = '+'; }
-        else if (*p == '_') { *p = '/'; }
+#ifdef TW_BASE64_AVX2
+
+/// Encodes 24 input bytes to 32 characters per step, based on Wojciech Muła's "Base64 encoding with SIMD
+/// instructions" (multiply-shift unpacking and a pshufb offset lookup).
+/// Stops while at least 28 bytes remain so the second 16-byte load stays in bounds;
+/// returns the number of bytes consumed, a multiple of 24.
+__attribute__((target("avx2")))
+size_t encodeAvx2(const byte* in, size_t size, char* out, bool url) {
+    const auto reshuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const char last62 = url ? '-' : '+';
+    const char last63 = url ? '_' : '/';
+    // offsets from a 6-bit value to its character, selected by the value range
+    const auto offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, last62 - 62, last63 - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, last62 - 62, last63 - 63, 'A', 0, 0);
+
+    size_t i = 0;
+    for (; size - i >= 28; i += 24) {
+        // 12 input bytes per 128-bit lane
+        auto input = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12)), 1);
+        input = _mm256_shuffle_epi8(input, reshuffle);
+
+        // split each 3-byte group into four 6-bit values, one per byte
+        const auto t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00));
+        const auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const auto t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0));
+        const auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        const auto values = _mm256_or_si256(t1, t3);
+
+        // 0..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12, then 0..25 -> 13
+        auto ranges = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        const auto upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+        ranges = _mm256_or_si256(ranges, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        const auto chars = _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, ranges));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), chars);
+        out += 32;
     }
+    return i;
 }
 
-/// Convert from regular format to Base64Url
-void convertToBase64Url(string& b) {
-    // '+' and '/' are changed to '-' and '_' (Base64URL format)
-    // in-place replace
-    size_t n = b.length();
-    char* start = b.data();
-    char* end = start + n;
-    for(auto p = start; p < end; ++p) {
-        if (*p == '+') { *p = '-'; }
-        else if (*p == '/') { *p = '_'; }
+/// Decodes 32 characters to 24 bytes per step, based on Wojciech Muła's "Base64 decoding with SIMD instructions"
+/// (nibble lookups for validation and translation, multiply-add packing).
+/// Stops at the first block holding a character outside the alphabet, leaving it to the scalar decoder to report;
+/// returns the number of characters consumed, a multiple of 32.
+__attribute__((target("avx2")))
+size_t decodeAvx2(const byte* in, size_t size, byte* out, bool url) {
+    // a character is invalid when the bits selected by its low and high nibbles intersect
+    const auto lowNibbleBits = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const auto highNibbleBits = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    // offsets from a character to its value by high nibble; index 1 is '/', shifted there by the equality mask
+    const auto offsets = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const auto nibbleMask = _mm256_set1_epi8(0x0f);
+    const auto slash = _mm256_set1_epi8('/');
+
+    size_t i = 0;
+    for (; size - i >= 32; i += 32) {
+        auto chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        if (url) {
+            chars = _mm256_blendv_epi8(chars, _mm256_set1_epi8('+'), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('-')));
+            chars = _mm256_blendv_epi8(chars, slash, _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('_')));
+        }
+
+        const auto highNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), nibbleMask);
+        const auto lowNibbles = _mm256_and_si256(chars, nibbleMask);
+        // characters >= 0x80 have a high nibble of 8 or more, which is never valid
+        const auto high = _mm256_shuffle_epi8(highNibbleBits, highNibbles);
+        const auto low = _mm256_shuffle_epi8(lowNibbleBits, lowNibbles);
+        if (!_mm256_testz_si256(low, high)) {
+            break;
+        }
+
+        const auto offsetIndex = _mm256_add_epi8(_mm256_cmpeq_epi8(chars, slash), highNibbles);
+        const auto values = _mm256_add_epi8(chars, _mm256_shuffle_epi8(offsets, offsetIndex));
+
+        // four 6-bit values to three bytes per 32-bit word, then drop the gaps
+        const auto pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        auto bytes = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        bytes = _mm256_shuffle_epi8(bytes, pack);
+        bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16), _mm256_extracti128_si256(bytes, 1));
+        out += 24;
     }
+    return i;
 }
 
-Data decodeBase64Url(const string& val) {
-    Data bytes;
-    try {
-        return decode(val);
-    } catch (const exception& ex) {
-        // 2nd try: Base64URL format (replaced by '-' and '_' by '+' and '/' )
-        string base64Url = val;
-        convertFromBase64Url(base64Url);
-        return decode(base64Url);
+bool hasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif // TW_BASE64_AVX2
+
+string encode(const Data& val, bool url) {
+    const auto* alphabet = url ? urlAlphabet : standardAlphabet;
+    const auto size = val.size();
+    string encoded((size + 2) / 3 * 4, '=');
+    const auto* in = val.data();
+    auto* out = encoded.data();
+
+    size_t i = 0;
+#ifdef TW_BASE64_AVX2
+    if (hasAvx2()) {
+        i = encodeAvx2(in, size, out, url);
+        out += i / 3 * 4;
+    }
+#endif
+    for (; size - i >= 3; i += 3) {
+        const uint32_t group = (uint32_t(in[i]) << 16) | (uint32_t(in[i + 1]) << 8) | in[i + 2];
+        *out++ = alphabet[group >> 18];
+        *out++ = alphabet[(group >> 12) & 0x3f];
+        *out++ = alphabet[(group >> 6) & 0x3f];
+        *out++ = alphabet[group & 0x3f];
+    }
+    // the remaining one or two bytes, padding is already in place
+    if (i < size) {
+        const uint32_t group = (uint32_t(in[i]) << 16) | (i + 1 < size ? uint32_t(in[i + 1]) << 8 : 0);
+        out[0] = alphabet[group >> 18];
+        out[1] = alphabet[(group >> 12) & 0x3f];
+        if (i + 1 < size) {
+            out[2] = alphabet[(group >> 6) & 0x3f];
+        }
+    }
+    return encoded;
+}
+
+/// Strict decoding: padding is optional but must complete the last quartet when present, and the unused bits of
+/// a partial quartet must be zero. Throws std::invalid_argument otherwise.
+Data decode(const string& val, bool url) {
+    const auto& table = url ? urlTable : standardTable;
+    auto size = val.size();
+    size_t padding = 0;
+    while (padding < 2 && size > 0 && val[size - 1] == '=') {
+        --size;
+        ++padding;
+    }
+    if ((padding > 0 && val.size() % 4 != 0) || size % 4 == 1) {
+        invalidString();
+    }
+
+    const auto* in = reinterpret_cast<const byte*>(val.data());
+    Data decoded(size / 4 * 3 + (size % 4 == 0 ? 0 : size % 4 - 1));
+    auto* out = decoded.data();
+
+    size_t i = 0;
+#ifdef TW_BASE64_AVX2
+    if (hasAvx2()) {
+        i = decodeAvx2(in, size, out, url);
+        out += i / 4 * 3;
+    }
+#endif
+    for (; size - i >= 4; i += 4) {
+        const auto a = table[in[i]];
+        const auto b = table[in[i + 1]];
+        const auto c = table[in[i + 2]];
+        const auto d = table[in[i + 3]];
+        if ((a | b | c | d) & 0x80) {
+            invalidString();
+        }
+        const uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | d;
+        *out++ = static_cast<byte>(group >> 16);
+        *out++ = static_cast<byte>(group >> 8);
+        *out++ = static_cast<byte>(group);
     }
+    if (i < size) {
+        const auto a = table[in[i]];
+        const auto b = table[in[i + 1]];
+        const auto c = size - i == 3 ? table[in[i + 2]] : byte(0);
+        // the bits past the last whole byte must be zero
+        const auto unused = size - i == 3 ? (c & 0x03) : (b & 0x0f);
+        if (((a | b | c) & 0x80) || unused != 0) {
+            invalidString();
+        }
+        out[0] = static_cast<byte>((a << 2) | (b >> 4));
+        if (size - i == 3) {
+            out[1] = static_cast<byte>((b << 4) | (c >> 2));
+        }
+    }
+    return decoded;
+}
+
+} // namespace
+
+Data decode(const string& val) {
+    return decode(val, false);
+}
+
+string encode(const Data& val) {
+    return encode(val, false);
+}
+
+Data decodeBase64Url(const string& val) {
+    return decode(val, true);
 }
 
 string encodeBase64Url(const Data& val) {
-    using namespace boost::archive::iterators;
-    using It = base64_from_binary<transform_width<Data::const_iterator, 6, 8>>;
-    auto encoded = string(It(begin(val)), It(end(val)));
-    encoded.append((3 - val.size() % 3) % 3, '=');
-    convertToBase64Url(encoded);
-    return encoded;
+    return encode(val, true);
 }
 
 } // namespace TW::Base64
@@ -10,7 +10,8 @@
 
 namespace TW::Base64 {
 
-// Decode a Base64-format string
+// Decode a Base64-format string; padding is optional.
+// Throws std::invalid_argument if the string is not valid Base64.
 Data decode(const std::string& val);
 
 // Encode bytes into Base64 string
@@ -18,6 +19,7 @@ std::string encode(const Data& val);
 
 // Decode a Base64Url-format or a regular Base64 string.
 // Base64Url format uses '-' and '_' as the two special characters, Base64 uses '+'and '/'.
+// Throws std::invalid_argument if the string is not valid in either format.
 Data decodeBase64Url(const std::string& val);
 
 // Encode bytes into Base64Url string (uses '-' and '_' as pecial characters)
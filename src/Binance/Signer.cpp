@@ -11,14 +11,18 @@
 #include "../PrivateKey.h"
 
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/util/json_util.h>
 
+#include <cassert>
 #include <string>
 
 using namespace TW;
 using namespace TW::Binance;
 
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::internal::WireFormatLite;
+
 // Message prefixes
 // see https://docs.binance.org/api-reference/transactions.html#amino-types
 static const auto sendOrderPrefix = Data{0x2A, 0x2C, 0x87, 0xFA};
@@ -60,8 +64,7 @@ std::string Signer::signJSON(const std::string& json, const Data& key) {
 }
 
 Data Signer::build() const {
-    auto signature = encodeSignature(sign());
-    return encodeTransaction(signature);
+    return encodeTransaction(sign());
 }
 
 Data Signer::sign() const {
@@ -77,88 +80,126 @@ std::string Signer::signaturePreimage() const {
 }
 
 Data Signer::encodeTransaction(const Data& signature) const {
-    auto msg = encodeOrder();
-    auto transaction = Binance::Proto::Transaction();
-    transaction.add_msgs(msg.data(), msg.size());
-    transaction.add_signatures(signature.data(), signature.size());
-    transaction.set_memo(input.memo());
-    transaction.set_source(input.source());
-
-    auto data = transaction.SerializeAsString();
-    return aminoWrap(data, transactionPrefix, true);
+    Data prefix;
+    const auto* order = orderMessage(prefix);
+    auto signatureObject = encodeSignature(signature);
+
+    // Compute all sizes first so the whole StdTx is written into a single buffer, without intermediate copies.
+    const auto orderSize = prefix.size() + (order != nullptr ? order->ByteSizeLong() : 0);
+    const auto signatureSize = signatureObject.ByteSizeLong();
+    const auto& memo = input.memo();
+    const auto source = input.source();
+
+    auto contentsSize = transactionPrefix.size();
+    contentsSize += 1 + CodedOutputStream::VarintSize64(orderSize) + orderSize;
+    contentsSize += 1 + CodedOutputStream::VarintSize64(signatureSize) + signatureSize;
+    if (!memo.empty()) {
+        contentsSize += 1 + CodedOutputStream::VarintSize64(memo.size()) + memo.size();
+    }
+    if (source != 0) {
+        contentsSize += 1 + CodedOutputStream::VarintSize64(static_cast<uint64_t>(source));
+    }
+
+    auto encoded = Data(CodedOutputStream::VarintSize64(contentsSize) + contentsSize);
+    auto* ptr = encoded.data();
+    ptr = CodedOutputStream::WriteVarint64ToArray(contentsSize, ptr);
+    ptr = CodedOutputStream::WriteRawToArray(transactionPrefix.data(), static_cast<int>(transactionPrefix.size()), ptr);
+
+    // msgs = 1, the amino-prefixed order
+    ptr = CodedOutputStream::WriteTagToArray(WireFormatLite::MakeTag(1, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), ptr);
+    ptr = CodedOutputStream::WriteVarint64ToArray(orderSize, ptr);
+    ptr = CodedOutputStream::WriteRawToArray(prefix.data(), static_cast<int>(prefix.size()), ptr);
+    if (order != nullptr) {
+        ptr = order->SerializeWithCachedSizesToArray(ptr);
+    }
+
+    // signatures = 2
+    ptr = CodedOutputStream::WriteTagToArray(WireFormatLite::MakeTag(2, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), ptr);
+    ptr = CodedOutputStream::WriteVarint64ToArray(signatureSize, ptr);
+    ptr = signatureObject.SerializeWithCachedSizesToArray(ptr);
+
+    // memo = 3, source = 4; proto3 omits default values
+    if (!memo.empty()) {
+        ptr = CodedOutputStream::WriteTagToArray(WireFormatLite::MakeTag(3, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), ptr);
+        ptr = CodedOutputStream::WriteStringWithSizeToArray(memo, ptr);
+    }
+    if (source != 0) {
+        ptr = CodedOutputStream::WriteTagToArray(WireFormatLite::MakeTag(4, WireFormatLite::WIRETYPE_VARINT), ptr);
+        ptr = CodedOutputStream::WriteVarint64ToArray(static_cast<uint64_t>(source), ptr);
+    }
+    assert(ptr == encoded.data() + encoded.size());
+    return encoded;
 }
 
-Data Signer::encodeOrder() const {
-    std::string data;
-    Data prefix;
+const google::protobuf::MessageLite* Signer::orderMessage(Data& prefix) const {
     if (input.has_trade_order()) {
-        data = input.trade_order().SerializeAsString();
         prefix = tradeOrderPrefix;
+        return &input.trade_order();
     } else if (input.has_cancel_trade_order()) {
-        data = input.cancel_trade_order().SerializeAsString();
         prefix = cancelTradeOrderPrefix;
+        return &input.cancel_trade_order();
     } else if (input.has_send_order()) {
-        data = input.send_order().SerializeAsString();
         prefix = sendOrderPrefix;
+        return &input.send_order();
     } else if (input.has_issue_order()) {
-        data = input.issue_order().SerializeAsString();
         prefix = tokenIssueOrderPrefix;
+        return &input.issue_order();
     } else if (input.has_mint_order()) {
-        data = input.mint_order().SerializeAsString();
         prefix = tokenMintOrderPrefix;
+        return &input.mint_order();
     } else if (input.has_burn_order()) {
-        data = input.burn_order().SerializeAsString();
         prefix = tokenBurnOrderPrefix;
+        return &input.burn_order();
     } else if (input.has_freeze_order()) {
-        data = input.freeze_order().SerializeAsString();
         prefix = tokenFreezeOrderPrefix;
+        return &input.freeze_order();
     } else if (input.has_unfreeze_order()) {
-        data = input.unfreeze_order().SerializeAsString();
         prefix = tokenUnfreezeOrderPrefix;
+        return &input.unfreeze_order();
     } else if (input.has_htlt_order()) {
-        data = input.htlt_order().SerializeAsString();
         prefix = HTLTOrderPrefix;
+        return &input.htlt_order();
     } else if (input.has_deposithtlt_order()) {
-        data = input.deposithtlt_order().SerializeAsString();
         prefix = depositHTLTOrderPrefix;
+        return &input.deposithtlt_order();
     } else if (input.has_claimhtlt_order()) {
-        data = input.claimhtlt_order().SerializeAsString();
         prefix = claimHTLTOrderPrefix;
+        return &input.claimhtlt_order();
     } else if (input.has_refundhtlt_order()) {
-        data = input.refundhtlt_order().SerializeAsString();
         prefix = refundHTLTOrderPrefix;
+        return &input.refundhtlt_order();
     } else if (input.has_transfer_out_order()) {
-        data = input.transfer_out_order().SerializeAsString();
         prefix = transferOutOrderPrefix;
+        return &input.transfer_out_order();
     } else if (input.has_side_delegate_order()) {
-        data = input.side_delegate_order().SerializeAsString();
         prefix = sideDelegateOrderPrefix;
+        return &input.side_delegate_order();
     } else if (input.has_side_redelegate_order()) {
-        data = input.side_redelegate_order().SerializeAsString();
         prefix = sideRedelegateOrderPrefix;
+        return &input.side_redelegate_order();
     } else if (input.has_side_undelegate_order()) {
-        data = input.side_undelegate_order().SerializeAsString();
         prefix = sideUndelegateOrderPrefix;
+        return &input.side_undelegate_order();
     } else if (input.has_time_lock_order()) {
-        data = input.time_lock_order().SerializeAsString();
         prefix = timeLockOrderPrefix;
+        return &input.time_lock_order();
     } else if (input.has_time_relock_order()) {
-        data = input.time_relock_order().SerializeAsString();
         prefix = timeRelockOrderPrefix;
+        return &input.time_relock_order();
     } else if (input.has_time_unlock_order()) {
-        data = input.time_unlock_order().SerializeAsString();
         prefix = timeUnlockOrderPrefix;
-    } else {
-        return {};
+        return &input.time_unlock_order();
     }
-    return aminoWrap(data, prefix, false);
+    return nullptr;
 }
 
-Data Signer::encodeSignature(const Data& signature) const {
+Proto::Signature Signer::encodeSignature(const Data& signature) const {
     auto key = PrivateKey(input.private_key());
     auto publicKey = key.getPublicKey(TWPublicKeyTypeSECP256k1);
 
-    auto encodedPublicKey = pubKeyPrefix;
+    auto encodedPublicKey = Data();
+    encodedPublicKey.reserve(pubKeyPrefix.size() + 1 + publicKey.bytes.size());
+    encodedPublicKey.insert(encodedPublicKey.end(), pubKeyPrefix.begin(), pubKeyPrefix.end());
     encodedPublicKey.insert(encodedPublicKey.end(), static_cast<uint8_t>(publicKey.bytes.size()));
     encodedPublicKey.insert(encodedPublicKey.end(), publicKey.bytes.begin(), publicKey.bytes.end());
 
@@ -167,28 +208,5 @@ Data Signer::encodeSignature(const Data& signature) const {
     object.set_signature(signature.data(), signature.size());
     object.set_account_number(input.account_number());
     object.set_sequence(input.sequence());
-
-    return aminoWrap(object.SerializeAsString(), {}, false);
-}
-
-Data Signer::aminoWrap(const std::string& raw, const Data& typePrefix, bool prefixWithSize) const {
-    const auto contentsSize = raw.size() + typePrefix.size();
-    auto size = contentsSize;
-    if (prefixWithSize) {
-        size += 10;
-    }
-
-    std::string msg;
-    msg.reserve(size);
-    {
-        google::protobuf::io::StringOutputStream output(&msg);
-        google::protobuf::io::CodedOutputStream cos(&output);
-        if (prefixWithSize) {
-            cos.WriteVarint64(contentsSize);
-        }
-        cos.WriteRaw(typePrefix.data(), static_cast<int>(typePrefix.size()));
-        cos.WriteRaw(raw.data(), static_cast<int>(raw.size()));
-    }
-
-    return Data(msg.begin(), msg.end());
+    return object;
 }
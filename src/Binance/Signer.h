@@ -40,11 +40,11 @@ class Signer {
 
   private:
     std::string signaturePreimage() const;
+    /// Encodes the length-prefixed StdTx, writing the order and signature in place into a single buffer.
     TW::Data encodeTransaction(const TW::Data& signature) const;
-    TW::Data encodeOrder() const;
-    TW::Data encodeSignature(const TW::Data& signature) const;
-    TW::Data aminoWrap(const std::string& raw, const TW::Data& typePrefix,
-                       bool isPrefixLength) const;
+    /// Returns the order message set in the input and its amino type prefix, or nullptr if there is none.
+    const google::protobuf::MessageLite* orderMessage(TW::Data& prefix) const;
+    Proto::Signature encodeSignature(const TW::Data& signature) const;
 };
 
 } // namespace TW::Binance
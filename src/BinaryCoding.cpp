@@ -5,8 +5,7 @@
 // file LICENSE at the root of the source code distribution tree.
 
 #include "BinaryCoding.h"
-
-#include <cassert>
+#include "VarInt.h"
 
 namespace TW {
 
@@ -37,78 +36,22 @@ uint64_t decode64LE(const uint8_t* _Nonnull src) {
 }
 
 uint8_t varIntSize(uint64_t value) {
-    // The value is small enough to be represented by itself.
-    if (value < 0xfd) {
-        return 1;
-    }
-
-    // Discriminant 1 byte plus 2 bytes for the uint16.
-    if (value <= UINT16_MAX) {
-        return 1 + 2;
-    }
-
-    // Discriminant 1 byte plus 4 bytes for the uint32.
-    if (value <= UINT32_MAX) {
-        return 1 + 4;
-    }
-
-    // Discriminant 1 byte plus 8 bytes for the uint64.
-    return 1 + 8;
+    return static_cast<uint8_t>(VarInt::compactSizeLength(value));
 }
 
 uint8_t encodeVarInt(uint64_t size, vector<uint8_t>& data) {
-    if (size < 0xfd) {
-        data.push_back(static_cast<uint8_t>(size));
-        return 1;
-    }
-
-    if (size <= UINT16_MAX) {
-        data.push_back(0xfd);
-        encode16LE((uint16_t)size, data);
-        return 3;
-    }
-
-    if (size <= UINT32_MAX) {
-        data.push_back(0xfe);
-        encode32LE((uint32_t)size, data);
-        return 5;
-    }
-
-    data.push_back(0xff);
-    encode64LE((uint64_t)size, data);
-    return 9;
+    byte buffer[VarInt::maxCompactSizeLength];
+    const auto length = VarInt::writeCompactSize(size, buffer);
+    data.insert(data.end(), buffer, buffer + length);
+    return static_cast<uint8_t>(length);
 }
 
 tuple<bool, uint64_t> decodeVarInt(const Data& in, size_t& indexInOut) {
-    if (in.size() < indexInOut + 1) {
-        // too short
-        return make_tuple(false, 0);
-    }
-    // extra bytes except first
-    uint8_t size = 0;
-    const auto firstByte = in[indexInOut];
-    switch (firstByte) {
-        case 0xfd: size = 2; break;
-        case 0xfe: size = 4; break;
-        case 0xff: size = 8; break;
-        default: size = 0; break; // one-byte case is one byte, with not discriminator
-    }
-    ++indexInOut;
-    assert(size == 0 || size == 2 || size == 4 || size == 8);
-    if (in.size() < indexInOut + size) {
+    uint64_t number = 0;
+    if (!VarInt::readCompactSize(in.data(), in.size(), indexInOut, number)) {
         // too short
         return make_tuple(false, 0);
     }
-
-    uint64_t number = 0;
-    switch (size) {
-        default:
-        case 0: number = firstByte; break;
-        case 2: number = decode16LE(in.data() + indexInOut); break;
-        case 4: number = decode32LE(in.data() + indexInOut); break;
-        case 8: number = decode64LE(in.data() + indexInOut); break;
-    }
-    indexInOut += size;
     return make_tuple(true, number);
 }
 
@@ -0,0 +1,28 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "../Data.h"
+
+#include <cstddef>
+
+namespace TW::Bitcoin {
+
+/// Non-owning range of bytes inside a script or raw transaction.
+struct ByteView {
+    const byte* data = nullptr;
+    size_t size = 0;
+
+    const byte* begin() const { return data; }
+    const byte* end() const { return data + size; }
+    bool empty() const { return size == 0; }
+
+    /// Copies the bytes out of the underlying buffer.
+    Data toData() const { return Data(begin(), end()); }
+};
+
+} // namespace TW::Bitcoin
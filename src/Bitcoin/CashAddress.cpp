@@ -7,7 +7,6 @@
 #include "CashAddress.h"
 #include "../Coin.h"
 
-#include <TrezorCrypto/cash_addr.h>
 #include <TrezorCrypto/ecdsa.h>
 
 #include <array>
@@ -24,41 +23,173 @@ static const std::string cashHRP = "bitcoincash";
 static const uint8_t p2khVersion = 0x00;
 static const uint8_t p2shVersion = 0x08;
 
-static constexpr size_t maxHRPSize = 20;
-static constexpr size_t maxDataSize = 104;
+namespace {
 
-bool CashAddress::isValid(const std::string& string) {
-    auto withPrefix = string;
-    if (!std::equal(cashHRP.begin(), cashHRP.end(), string.begin())) {
-        withPrefix = cashHRP + ":" + string;
+constexpr size_t checksumSize = 8;
+
+const char* const charset = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+/// Generator terms of the polymod, combined for every value of the 5 bits shifted out at each step.
+constexpr std::array<uint64_t, 32> makePolymodTable() {
+    constexpr uint64_t generator[5] = {0x98f2bc8e61, 0x79b76d99e2, 0xf33e5fb3c4, 0xae2eabe2a8, 0x1e4f43e470};
+    std::array<uint64_t, 32> table{};
+    for (size_t value = 0; value < 32; ++value) {
+        for (size_t bit = 0; bit < 5; ++bit) {
+            if ((value >> bit) & 1) {
+                table[value] ^= generator[bit];
+            }
+        }
     }
+    return table;
+}
 
-    std::array<char, maxHRPSize + 1> hrp = {0};
-    std::array<uint8_t, maxDataSize> data;
-    size_t dataLen;
-    if (cash_decode(hrp.data(), data.data(), &dataLen, withPrefix.c_str()) == 0 || dataLen != CashAddress::size) {
-        return false;
+constexpr auto polymodTable = makePolymodTable();
+
+constexpr uint64_t polymodStep(uint64_t pre) {
+    return ((pre & 0x7FFFFFFFFULL) << 5) ^ polymodTable[pre >> 35];
+}
+
+/// Polymod state after the "bitcoincash" prefix and the separator.
+constexpr uint64_t prefixChecksum() {
+    constexpr char prefix[] = "bitcoincash";
+    uint64_t chk = 1;
+    for (size_t i = 0; prefix[i] != 0; ++i) {
+        chk = polymodStep(chk) ^ (prefix[i] & 0x1f);
+    }
+    return polymodStep(chk);
+}
+
+/// Value of a lowercase charset character, -1 for any other character.
+constexpr std::array<int8_t, 256> makeCharsetReverse() {
+    std::array<int8_t, 256> table{};
+    for (auto& value : table) {
+        value = -1;
     }
-    if (std::strncmp(hrp.data(), cashHRP.c_str(), std::min(cashHRP.size(), maxHRPSize)) != 0) {
+    constexpr char chars[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+    for (size_t i = 0; i < 32; ++i) {
+        table[static_cast<uint8_t>(chars[i])] = static_cast<int8_t>(i);
+    }
+    return table;
+}
+
+constexpr auto charsetReverse = makeCharsetReverse();
+
+/// Decodes the 5-bit groups of a lowercase address, with or without the "bitcoincash:" prefix, checking the checksum.
+bool decodeGroups(const std::string& string, std::array<TW::byte, CashAddress::size>& groups) {
+    size_t start = 0;
+    if (string.size() > cashHRP.size() && string.compare(0, cashHRP.size(), cashHRP) == 0 && string[cashHRP.size()] == ':') {
+        start = cashHRP.size() + 1;
+    }
+    if (string.size() - start != CashAddress::size + checksumSize) {
         return false;
     }
-    return true;
+
+    auto chk = prefixChecksum();
+    for (size_t i = 0; i < CashAddress::size + checksumSize; ++i) {
+        const auto value = charsetReverse[static_cast<uint8_t>(string[start + i])];
+        if (value < 0) {
+            return false;
+        }
+        chk = polymodStep(chk) ^ static_cast<uint64_t>(value);
+        if (i < CashAddress::size) {
+            groups[i] = static_cast<TW::byte>(value);
+        }
+    }
+    return chk == 1;
 }
 
-CashAddress::CashAddress(const std::string& string) {
-    auto withPrefix = string;
-    if (!std::equal(cashHRP.begin(), cashHRP.end(), string.begin())) {
-        withPrefix = cashHRP + ":" + string;
+/// Encodes 5-bit groups with the "bitcoincash:" prefix and checksum, straight into the result string.
+std::string encodeGroups(const std::array<TW::byte, CashAddress::size>& groups) {
+    std::string result;
+    result.reserve(cashHRP.size() + 1 + CashAddress::size + checksumSize);
+    result.append(cashHRP);
+    result.push_back(':');
+
+    auto chk = prefixChecksum();
+    for (auto group : groups) {
+        chk = polymodStep(chk) ^ group;
+        result.push_back(charset[group]);
+    }
+    for (size_t i = 0; i < checksumSize; ++i) {
+        chk = polymodStep(chk);
     }
+    chk ^= 1;
+    for (size_t i = 0; i < checksumSize; ++i) {
+        result.push_back(charset[(chk >> ((checksumSize - 1 - i) * 5)) & 0x1f]);
+    }
+    return result;
+}
 
-    std::array<char, maxHRPSize + 1> hrp;
-    std::array<uint8_t, maxDataSize> data;
-    size_t dataLen;
-    auto success = cash_decode(hrp.data(), data.data(), &dataLen, withPrefix.c_str()) != 0;
-    if (!success || std::strncmp(hrp.data(), cashHRP.c_str(), std::min(cashHRP.size(), maxHRPSize)) != 0 || dataLen != CashAddress::size) {
+std::array<TW::byte, CashAddress::size> groupsFromPayload(const CashAddress::Payload& payload) {
+    std::array<TW::byte, CashAddress::size> groups;
+    uint32_t value = 0;
+    int bits = 0;
+    size_t index = 0;
+    for (auto byte : payload) {
+        value = (value << 8) | byte;
+        bits += 8;
+        while (bits >= 5) {
+            bits -= 5;
+            groups[index++] = (value >> bits) & 0x1f;
+        }
+    }
+    // the remaining bits, padded with zeroes
+    groups[index] = (value << (5 - bits)) & 0x1f;
+    assert(index + 1 == CashAddress::size);
+    return groups;
+}
+
+CashAddress::Payload payloadFromGroups(const std::array<TW::byte, CashAddress::size>& groups) {
+    CashAddress::Payload payload;
+    uint32_t value = 0;
+    int bits = 0;
+    size_t index = 0;
+    for (auto group : groups) {
+        value = (value << 5) | group;
+        bits += 5;
+        if (bits >= 8) {
+            bits -= 8;
+            payload[index++] = static_cast<TW::byte>(value >> bits);
+        }
+    }
+    // the last 2 bits are padding
+    assert(index == CashAddress::payloadSize);
+    return payload;
+}
+
+} // namespace
+
+bool CashAddress::isValid(const std::string& string) {
+    std::array<byte, size> groups;
+    return decodeGroups(string, groups);
+}
+
+std::vector<bool> CashAddress::validate(const std::vector<std::string>& strings) {
+    std::vector<bool> result;
+    result.reserve(strings.size());
+    std::array<byte, size> groups;
+    for (const auto& string : strings) {
+        result.push_back(decodeGroups(string, groups));
+    }
+    return result;
+}
+
+std::optional<CashAddress::Payload> CashAddress::decode(const std::string& string) {
+    std::array<byte, size> groups;
+    if (!decodeGroups(string, groups)) {
+        return std::nullopt;
+    }
+    return payloadFromGroups(groups);
+}
+
+std::string CashAddress::encode(const Payload& payload) {
+    return encodeGroups(groupsFromPayload(payload));
+}
+
+CashAddress::CashAddress(const std::string& string) {
+    if (!decodeGroups(string, bytes)) {
         throw std::invalid_argument("Invalid address string");
     }
-    std::copy(data.begin(), data.begin() + dataLen, bytes.begin());
 }
 
 CashAddress::CashAddress(const Data& data) {
@@ -72,28 +203,23 @@ CashAddress::CashAddress(const PublicKey& publicKey) {
     if (publicKey.type != TWPublicKeyTypeSECP256k1) {
         throw std::invalid_argument("CashAddress needs a compressed SECP256k1 public key.");
     }
-    std::array<uint8_t, 21> payload;
-    payload[0] = 0;
+    Payload payload;
+    payload[0] = p2khVersion;
     ecdsa_get_pubkeyhash(publicKey.bytes.data(), HASHER_SHA2_RIPEMD, payload.data() + 1);
+    bytes = groupsFromPayload(payload);
+}
 
-    size_t outlen = 0;
-    auto success = cash_addr_to_data(bytes.data(), &outlen, payload.data(), 21) != 0;
-    if (!success || outlen != CashAddress::size) {
-        throw std::invalid_argument("unable to cash_addr_to_data");
-    }
+CashAddress::Payload CashAddress::payload() const {
+    return payloadFromGroups(bytes);
 }
 
 std::string CashAddress::string() const {
-    std::array<char, 129> result;
-    cash_encode(result.data(), cashHRP.c_str(), bytes.data(), CashAddress::size);
-    return result.data();
+    return encodeGroups(bytes);
 }
 
 Address CashAddress::legacyAddress() const {
-    Data result(Address::size);
-    size_t outlen = 0;
-    cash_data_to_addr(result.data(), &outlen, bytes.data(), CashAddress::size);
-    assert(outlen == 21 && "Invalid length");
+    const auto data = payload();
+    Data result(data.begin(), data.end());
     if (result[0] == p2khVersion) {
         result[0] = TW::p2pkhPrefix(TWCoinTypeBitcoinCash);
     } else if (result[0] == p2shVersion) {
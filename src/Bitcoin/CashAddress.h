@@ -10,8 +10,11 @@
 #include "../PublicKey.h"
 #include "../Data.h"
 
+#include <array>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace TW::Bitcoin {
 
@@ -20,8 +23,13 @@ class CashAddress {
     /// Number of bytes in an address.
     static const size_t size = 34;
 
-    /// Address data consisting of a prefix byte followed by the public key
-    /// hash.
+    /// Number of bytes in the decoded payload.
+    static const size_t payloadSize = 21;
+
+    /// Decoded payload: version byte followed by the public key or script hash.
+    using Payload = std::array<byte, payloadSize>;
+
+    /// Address data: the payload split into 5-bit groups, padded.
     std::array<byte, size> bytes;
 
     /// Determines whether a collection of bytes makes a valid  address.
@@ -33,6 +41,15 @@ class CashAddress {
     /// Determines whether a string makes a valid  address.
     static bool isValid(const std::string& string);
 
+    /// Determines, for each string, whether it makes a valid address.
+    static std::vector<bool> validate(const std::vector<std::string>& strings);
+
+    /// Decodes a string straight into its payload; returns nullopt if it's not a valid address.
+    static std::optional<Payload> decode(const std::string& string);
+
+    /// Encodes a payload straight into a string representation.
+    static std::string encode(const Payload& payload);
+
     /// Initializes a  address with a string representation.
     explicit CashAddress(const std::string& string);
 
@@ -42,6 +59,9 @@ class CashAddress {
     /// Initializes a  address with a public key.
     explicit CashAddress(const PublicKey& publicKey);
 
+    /// Returns the decoded payload.
+    Payload payload() const;
+
     /// Returns a string representation of the address.
     std::string string() const;
 
@@ -11,7 +11,7 @@
 using namespace TW::Bitcoin;
 
 void OutPoint::encode(Data& data) const {
-    std::copy(std::begin(hash), std::end(hash), std::back_inserter(data));
+    data.insert(data.end(), hash.begin(), hash.end());
     encode32LE(index, data);
     // sequence is encoded in TransactionInputs
 }
@@ -45,6 +45,12 @@ class OutPoint {
         sequence = other.sequence();
     }
 
+    /// Size of the encoded out-point, in bytes.
+    static constexpr size_t encodedSize = 32 + 4;
+
+    /// Size of the encoded out-point, in bytes.
+    size_t size() const { return encodedSize; }
+
     /// Encodes the out-point into the provided buffer.
     void encode(Data& data) const;
 
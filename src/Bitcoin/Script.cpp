@@ -119,47 +119,22 @@ bool Script::matchMultisig(std::vector<Data>& keys, int& required) const {
     keys.clear();
     required = 0;
 
-    if (bytes.size() < 1 || bytes.back() != OP_CHECKMULTISIG) {
+    const auto result = classify();
+    if (result.type != ScriptType::multisig) {
         return false;
     }
-
-    size_t it = 0;
-    uint8_t opcode;
-    Data operand;
-
-    auto op = getScriptOp(it, opcode, operand);
-    if (!op || !TWOpCodeIsSmallInteger(opcode)) {
-        return false;
+    required = result.required;
+    for (size_t i = 0; i < result.keyCount; ++i) {
+        keys.push_back(result.keys[i].toData());
     }
-    required = decodeNumber(opcode);
-    while (true) {
-        auto res = getScriptOp(it, opcode, operand);
-        if (!res) {
-            break;
-        }
-        if (!PublicKey::isValid(operand, TWPublicKeyTypeSECP256k1)) {
-            break;
-        }
-        keys.push_back(operand);
-    }
-
-    if (!TWOpCodeIsSmallInteger(opcode)) {
-        return false;
-    }
-
-    auto expectedCount = decodeNumber(opcode);
-    if (keys.size() != expectedCount || expectedCount < required) {
-        return false;
-    }
-    if (it + 1 != bytes.size()) {
-        return false;
-    }
-
     return true;
 }
 
-bool Script::getScriptOp(size_t& index, uint8_t& opcode, Data& operand) const {
-    operand.clear();
+namespace {
+
+/// Reads the operation at index, like Script::getScriptOp, but returns the operand as a view into bytes.
+bool readScriptOp(const Data& bytes, size_t& index, uint8_t& opcode, ByteView& operand) {
+    operand = ByteView{};
 
     // Read instruction
     if (index >= bytes.size()) {
@@ -199,12 +174,87 @@ bool Script::getScriptOp(size_t& index, uint8_t& opcode, Data& operand) const {
     if (bytes.size() - index < size) {
         return false;
     }
-    operand = Data(bytes.begin() + index, bytes.begin() + index + size);
+    operand = ByteView{bytes.data() + index, size};
     index += size;
 
     return true;
 }
 
+/// <required> <compressed public key>... <count> OP_CHECKMULTISIG
+bool classifyMultisig(const Data& bytes, ScriptClass& result) {
+    size_t it = 0;
+    uint8_t opcode;
+    ByteView operand;
+
+    if (!readScriptOp(bytes, it, opcode, operand) || !TWOpCodeIsSmallInteger(opcode)) {
+        return false;
+    }
+    result.required = Script::decodeNumber(opcode);
+    result.keyCount = 0;
+    while (readScriptOp(bytes, it, opcode, operand)) {
+        const bool isKey = operand.size == PublicKey::secp256k1Size && (operand.data[0] == 0x02 || operand.data[0] == 0x03);
+        if (!isKey) {
+            break;
+        }
+        if (result.keyCount == ScriptClass::maxMultisigKeys) {
+            // more keys than the count opcode can express
+            return false;
+        }
+        result.keys[result.keyCount++] = operand;
+    }
+
+    if (!TWOpCodeIsSmallInteger(opcode)) {
+        return false;
+    }
+    const auto expectedCount = Script::decodeNumber(opcode);
+    if (result.keyCount != static_cast<size_t>(expectedCount) || expectedCount < result.required) {
+        return false;
+    }
+    return it + 1 == bytes.size();
+}
+
+} // namespace
+
+ScriptClass Script::classify() const {
+    ScriptClass result;
+    const auto size = bytes.size();
+    if (isPayToScriptHash()) {
+        result.type = ScriptType::payToScriptHash;
+        result.data = ByteView{bytes.data() + 2, 20};
+    } else if (isWitnessProgram()) {
+        result.data = ByteView{bytes.data() + 2, size - 2};
+        if (bytes[0] == OP_0 && size == 22) {
+            result.type = ScriptType::payToWitnessPublicKeyHash;
+        } else if (bytes[0] == OP_0 && size == 34) {
+            result.type = ScriptType::payToWitnessScriptHash;
+        } else {
+            result.type = ScriptType::witnessProgram;
+        }
+    } else if (size == 25 && bytes[0] == OP_DUP && bytes[1] == OP_HASH160 && bytes[2] == 20 &&
+               bytes[23] == OP_EQUALVERIFY && bytes[24] == OP_CHECKSIG) {
+        result.type = ScriptType::payToPublicKeyHash;
+        result.data = ByteView{bytes.data() + 3, 20};
+    } else if ((size == PublicKey::secp256k1Size + 2 || size == PublicKey::secp256k1ExtendedSize + 2) &&
+               bytes[0] + 2u == size && bytes.back() == OP_CHECKSIG) {
+        result.type = ScriptType::payToPublicKey;
+        result.data = ByteView{bytes.data() + 1, bytes[0]};
+    } else if (size > 0 && bytes.back() == OP_CHECKMULTISIG) {
+        if (classifyMultisig(bytes, result)) {
+            result.type = ScriptType::multisig;
+        } else {
+            result = ScriptClass();
+        }
+    }
+    return result;
+}
+
+bool Script::getScriptOp(size_t& index, uint8_t& opcode, Data& operand) const {
+    ByteView view;
+    const auto result = readScriptOp(bytes, index, opcode, view);
+    operand = view.toData();
+    return result;
+}
+
 Script Script::buildPayToPublicKey(const Data& publicKey) {
     assert(publicKey.size() == PublicKey::secp256k1Size || publicKey.size() == PublicKey::secp256k1ExtendedSize);
     Script script;
@@ -256,9 +306,13 @@ Script Script::buildPayToWitnessScriptHash(const Data& scriptHash) {
     return Script::buildPayToWitnessProgram(scriptHash);
 }
 
+size_t Script::size() const {
+    return varIntSize(bytes.size()) + bytes.size();
+}
+
 void Script::encode(Data& data) const {
     encodeVarInt(bytes.size(), data);
-    std::copy(std::begin(bytes), std::end(bytes), std::back_inserter(data));
+    append(data, bytes);
 }
 
 Script Script::lockScriptForAddress(const std::string& string, enum TWCoinType coin) {
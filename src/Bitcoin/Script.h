@@ -6,17 +6,53 @@
 
 #pragma once
 
+#include "ByteView.h"
 #include "../Data.h"
 
 #include "OpCodes.h"
 #include <TrustWalletCore/TWCoinType.h>
 
+#include <array>
 #include <string>
 #include <vector>
 #include <cassert>
 
 namespace TW::Bitcoin {
 
+/// Standard script templates, as recognized by Script::classify().
+enum class ScriptType {
+    nonStandard,
+    payToPublicKey,
+    payToPublicKeyHash,
+    payToScriptHash,
+    payToWitnessPublicKeyHash,
+    payToWitnessScriptHash,
+    /// Witness program of another version or length.
+    witnessProgram,
+    multisig,
+};
+
+/// Result of Script::classify(): the template and views into the script's bytes.
+/// Only valid as long as the classified script is alive and unchanged.
+struct ScriptClass {
+    /// Maximum number of public keys of a standard multisig script.
+    static constexpr size_t maxMultisigKeys = 16;
+
+    ScriptType type = ScriptType::nonStandard;
+
+    /// Public key, key hash, script hash or witness program, depending on the type; empty for multisig.
+    ByteView data;
+
+    /// Multisig: number of required signatures.
+    int required = 0;
+
+    /// Multisig: number of public keys in keys.
+    size_t keyCount = 0;
+
+    /// Multisig: public keys.
+    std::array<ByteView, maxMultisigKeys> keys;
+};
+
 class Script {
   public:
     /// Script raw bytes.
@@ -50,6 +86,9 @@ class Script {
     /// Determines whether this is a witness programm script.
     bool isWitnessProgram() const;
 
+    /// Determines the standard template of the script in a single pass, without allocating.
+    ScriptClass classify() const;
+
     /// Matches the script to a pay-to-public-key (P2PK) script.
     bool matchPayToPublicKey(Data& publicKey) const;
 
@@ -91,6 +130,9 @@ class Script {
     /// address.
     static Script lockScriptForAddress(const std::string& address, enum TWCoinType coin);
 
+    /// Size of the encoded script (length prefix and bytes), in bytes.
+    size_t size() const;
+
     /// Encodes the script.
     void encode(Data& data) const;
 
@@ -97,8 +97,8 @@ Result<void, Common::Proto::SigningError> SignatureBuilder<Transaction>::sign(Sc
     }
 
     std::vector<Data> witnessStack;
-    Data data;
-    if (script.matchPayToWitnessPublicKeyHash(data)) {
+    const auto scriptType = script.classify().type;
+    if (scriptType == ScriptType::payToWitnessPublicKeyHash) {
         auto witnessScript = Script::buildPayToPublicKeyHash(results[0]);
         auto result = signStep(witnessScript, index, utxo, WITNESS_V0);
         if (!result) {
@@ -106,7 +106,7 @@ Result<void, Common::Proto::SigningError> SignatureBuilder<Transaction>::sign(Sc
         }
         witnessStack = result.payload();
         results.clear();
-    } else if (script.matchPayToWitnessScriptHash(data)) {
+    } else if (scriptType == ScriptType::payToWitnessScriptHash) {
         auto witnessScript = Script(results[0]);
         auto result = signStep(witnessScript, index, utxo, WITNESS_V0);
         if (!result) {
@@ -115,7 +115,7 @@ Result<void, Common::Proto::SigningError> SignatureBuilder<Transaction>::sign(Sc
         witnessStack = result.payload();
         witnessStack.push_back(move(witnessScript.bytes));
         results.clear();
-    } else if (script.isWitnessProgram()) {
+    } else if (scriptType == ScriptType::witnessProgram) {
         // Error: Unrecognized witness program.
         return Result<void, Common::Proto::SigningError>::failure(Common::Proto::Error_script_witness_program);
     }
@@ -137,20 +137,18 @@ Result<std::vector<Data>, Common::Proto::SigningError> SignatureBuilder<Transact
     transactionToSign.inputs = signedInputs;
     transactionToSign.outputs = transaction.outputs;
 
-    Data data;
-    std::vector<Data> keys;
-    int required;
-
-    if (script.matchPayToScriptHash(data)) {
-        auto redeemScript = scriptForScriptHash(data);
+    const auto match = script.classify();
+    switch (match.type) {
+    case ScriptType::payToScriptHash: {
+        auto redeemScript = scriptForScriptHash(match.data.toData());
         if (redeemScript.empty()) {
             // Error: Missing redeem script
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_script_redeem);
         }
         return Result<std::vector<Data>, Common::Proto::SigningError>::success({redeemScript});
     }
-    if (script.matchPayToWitnessScriptHash(data)) {
-        auto scripthash = Hash::ripemd(data);
+    case ScriptType::payToWitnessScriptHash: {
+        auto scripthash = Hash::ripemd(match.data.data, match.data.size);
         auto redeemScript = scriptForScriptHash(scripthash);
         if (redeemScript.empty()) {
             // Error: Missing redeem script
@@ -158,20 +156,19 @@ Result<std::vector<Data>, Common::Proto::SigningError> SignatureBuilder<Transact
         }
         return Result<std::vector<Data>, Common::Proto::SigningError>::success({redeemScript});
     }
-    if (script.matchPayToWitnessPublicKeyHash(data)) {
-        return Result<std::vector<Data>, Common::Proto::SigningError>::success({data});
-    }
-    if (script.isWitnessProgram()) {
+    case ScriptType::payToWitnessPublicKeyHash:
+        return Result<std::vector<Data>, Common::Proto::SigningError>::success({match.data.toData()});
+    case ScriptType::witnessProgram:
         // Error: Invalid sutput script
         return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_script_output);
-    }
-    if (script.matchMultisig(keys, required)) {
+    case ScriptType::multisig: {
         auto results = std::vector<Data>{{}}; // workaround CHECKMULTISIG bug
-        for (auto& pubKey : keys) {
-            if (results.size() >= required + 1) {
+        for (size_t i = 0; i < match.keyCount; ++i) {
+            if (results.size() >= match.required + 1) {
                 break;
             }
-            auto keyHash = Hash::ripemd(Hash::sha256(pubKey));
+            const auto& pubKey = match.keys[i];
+            auto keyHash = Hash::sha256ripemd(pubKey.data, pubKey.size);
             auto pair = keyPairForPubKeyHash(keyHash);
             if (!pair.has_value() && !estimationMode) {
                 // Error: missing key
@@ -184,11 +181,11 @@ Result<std::vector<Data>, Common::Proto::SigningError> SignatureBuilder<Transact
             }
             results.push_back(signature);
         }
-        results.resize(required + 1);
+        results.resize(match.required + 1);
         return Result<std::vector<Data>, Common::Proto::SigningError>::success(std::move(results));
     }
-    if (script.matchPayToPublicKey(data)) {
-        auto keyHash = Hash::ripemd(Hash::sha256(data));
+    case ScriptType::payToPublicKey: {
+        auto keyHash = Hash::sha256ripemd(match.data.data, match.data.size);
         auto pair = keyPairForPubKeyHash(keyHash);
         if (!pair.has_value() && !estimationMode) {
             // Error: Missing key
@@ -201,8 +198,8 @@ Result<std::vector<Data>, Common::Proto::SigningError> SignatureBuilder<Transact
         }
         return Result<std::vector<Data>, Common::Proto::SigningError>::success({signature});
     }
-    if (script.matchPayToPublicKeyHash(data)) {
-        auto pair = keyPairForPubKeyHash(data);
+    case ScriptType::payToPublicKeyHash: {
+        auto pair = keyPairForPubKeyHash(match.data.toData());
         if (!pair.has_value() && !estimationMode) {
             // Error: Missing keys
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_missing_private_key);
@@ -219,6 +216,9 @@ Result<std::vector<Data>, Common::Proto::SigningError> SignatureBuilder<Transact
         auto pubkey = std::get<1>(pair.value());
         return Result<std::vector<Data>, Common::Proto::SigningError>::success({signature, pubkey.bytes});
     }
+    case ScriptType::nonStandard:
+        break;
+    }
     // Error: Invalid output script
     return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_script_output);
 }
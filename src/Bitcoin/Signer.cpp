@@ -34,11 +34,12 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput &input) noexcept {
     tx.encode(encoded);
     output.set_encoded(encoded.data(), encoded.size());
 
-    Data txHashData = encoded;
+    // The transaction id hashes the non-segwit encoding, which is the default one unless there is witness data
+    Data nonSegwitEncoded;
     if (tx.hasWitness()) {
-        txHashData.clear();
-        tx.encode(txHashData, Transaction::SegwitFormatMode::NonSegwit);
+        tx.encode(nonSegwitEncoded, Transaction::SegwitFormatMode::NonSegwit);
     }
+    const auto& txHashData = nonSegwitEncoded.empty() ? encoded : nonSegwitEncoded;
     auto txHash = Hash::sha256d(txHashData.data(), txHashData.size());
     std::reverse(txHash.begin(), txHash.end());
     output.set_transaction_id(hex(txHash));
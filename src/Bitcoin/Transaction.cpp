@@ -23,6 +23,7 @@ Data Transaction::getPreImage(const Script& scriptCode, size_t index,
     assert(index < inputs.size());
 
     Data data;
+    data.reserve(4 + 32 + 32 + OutPoint::encodedSize + scriptCode.size() + 8 + 4 + 32 + 4 + 4);
 
     // Version
     encode32LE(version, data);
@@ -77,6 +78,7 @@ Data Transaction::getPreImage(const Script& scriptCode, size_t index,
 
 Data Transaction::getPrevoutHash() const {
     Data data;
+    data.reserve(inputs.size() * OutPoint::encodedSize);
     for (auto& input : inputs) {
         auto& outpoint = reinterpret_cast<const OutPoint&>(input.previousOutput);
         outpoint.encode(data);
@@ -87,6 +89,7 @@ Data Transaction::getPrevoutHash() const {
 
 Data Transaction::getSequenceHash() const {
     Data data;
+    data.reserve(inputs.size() * 4);
     for (auto& input : inputs) {
         encode32LE(input.sequence, data);
     }
@@ -96,6 +99,11 @@ Data Transaction::getSequenceHash() const {
 
 Data Transaction::getOutputsHash() const {
     Data data;
+    size_t size = 0;
+    for (auto& output : outputs) {
+        size += output.size();
+    }
+    data.reserve(size);
     for (auto& output : outputs) {
         output.encode(data);
     }
@@ -103,13 +111,40 @@ Data Transaction::getOutputsHash() const {
     return hash;
 }
 
-void Transaction::encode(Data& data, enum SegwitFormatMode segwitFormat) const {
-    bool useWitnessFormat = true;
+static bool isWitnessFormat(const Transaction& transaction, enum Transaction::SegwitFormatMode segwitFormat) {
     switch (segwitFormat) {
-        case NonSegwit: useWitnessFormat = false; break;
-        case IfHasWitness: useWitnessFormat = hasWitness(); break;
-        case Segwit: useWitnessFormat = true; break;
+        case Transaction::NonSegwit: return false;
+        case Transaction::IfHasWitness: return transaction.hasWitness();
+        case Transaction::Segwit: return true;
+    }
+    return true;
+}
+
+size_t Transaction::size(enum SegwitFormatMode segwitFormat) const {
+    size_t size = 4 + varIntSize(inputs.size()) + varIntSize(outputs.size()) + 4;
+    for (auto& input : inputs) {
+        size += input.size();
     }
+    for (auto& output : outputs) {
+        size += output.size();
+    }
+    if (isWitnessFormat(*this, segwitFormat)) {
+        size += 2 + witnessSize();
+    }
+    return size;
+}
+
+size_t Transaction::witnessSize() const {
+    size_t size = 0;
+    for (auto& input : inputs) {
+        size += input.witnessSize();
+    }
+    return size;
+}
+
+void Transaction::encode(Data& data, enum SegwitFormatMode segwitFormat) const {
+    const auto useWitnessFormat = isWitnessFormat(*this, segwitFormat);
+    data.reserve(data.size() + size(segwitFormat));
 
     encode32LE(version, data);
 
@@ -139,6 +174,7 @@ void Transaction::encode(Data& data, enum SegwitFormatMode segwitFormat) const {
 }
 
 void Transaction::encodeWitness(Data& data) const {
+    data.reserve(data.size() + witnessSize());
     for (auto& input : inputs) {
         input.encodeWitness(data);
     }
@@ -173,20 +209,29 @@ Data Transaction::getSignatureHashBase(const Script& scriptCode, size_t index,
                                        enum TWBitcoinSigHashType hashType) const {
     assert(index < inputs.size());
 
+    auto serializedInputCount =
+        (hashType & TWBitcoinSigHashTypeAnyoneCanPay) != 0 ? 1 : inputs.size();
+    auto hashNone = hashTypeIsNone(hashType);
+    auto hashSingle = hashTypeIsSingle(hashType);
+    auto serializedOutputCount = hashNone ? 0 : (hashSingle ? index + 1 : outputs.size());
+
+    // Upper bound of the pre-image size: blank outputs (9 bytes) are never larger than the outputs they replace
+    size_t size = 4 + varIntSize(serializedInputCount) + serializedInputCount * (OutPoint::encodedSize + 1 + 4) +
+                  scriptCode.size() + varIntSize(serializedOutputCount) + 4 + 4;
+    for (size_t subindex = 0; subindex < serializedOutputCount && subindex < outputs.size(); subindex += 1) {
+        size += outputs[subindex].size();
+    }
+
     Data data;
+    data.reserve(size);
 
     encode32LE(version, data);
 
-    auto serializedInputCount =
-        (hashType & TWBitcoinSigHashTypeAnyoneCanPay) != 0 ? 1 : inputs.size();
     encodeVarInt(serializedInputCount, data);
     for (auto subindex = 0; subindex < serializedInputCount; subindex += 1) {
         serializeInput(subindex, scriptCode, index, hashType, data);
     }
 
-    auto hashNone = hashTypeIsNone(hashType);
-    auto hashSingle = hashTypeIsSingle(hashType);
-    auto serializedOutputCount = hashNone ? 0 : (hashSingle ? index + 1 : outputs.size());
     encodeVarInt(serializedOutputCount, data);
     for (auto subindex = 0; subindex < serializedOutputCount; subindex += 1) {
         if (hashSingle && subindex != index) {
@@ -79,7 +79,17 @@ public:
         Segwit
     };
 
+    /// Size of the encoded transaction, in bytes; encode() appends exactly this many bytes.
+    size_t size(enum SegwitFormatMode segwitFormat) const;
+
+    /// Size of the encoded transaction in the default format, in bytes.
+    size_t size() const { return size(SegwitFormatMode::IfHasWitness); }
+
+    /// Size of the encoded witness part of the transaction (see encodeWitness), in bytes.
+    size_t witnessSize() const;
+
     /// Encodes the transaction into the provided buffer.
+    /// The buffer is grown once, by size(segwitFormat) bytes.
     void encode(Data& data, enum SegwitFormatMode segwitFormat) const;
 
     /// Default one-parameter version, needed for templated usage.
@@ -50,18 +50,14 @@ int64_t estimateSegwitFee(const FeeCalculator& feeCalculator, const TransactionP
 
     // Obtain the encoded size
     auto transaction = result.payload();
-    Data dataNonSegwit;
-    transaction.encode(dataNonSegwit, Transaction::SegwitFormatMode::NonSegwit);
-    int64_t sizeNonSegwit = dataNonSegwit.size();
+    int64_t sizeNonSegwit = transaction.size(Transaction::SegwitFormatMode::NonSegwit);
     uint64_t vSize = 0;
     // Check if there is segwit
     if (!transaction.hasWitness()) {
         // no segwit, virtual size is defined as non-segwit size
         vSize = sizeNonSegwit;
     } else {
-        Data dataWitness;
-        transaction.encodeWitness(dataWitness);
-        int64_t witnessSize = 2 + dataWitness.size();
+        int64_t witnessSize = 2 + transaction.witnessSize();
         // compute virtual size:  (smaller) non-segwit + 1/4 of the diff (witness-only)
         // (in other way: 3/4 of (smaller) non-segwit + 1/4 of segwit size)
         vSize = sizeNonSegwit + witnessSize/4 + (witnessSize % 4 != 0);
@@ -17,10 +17,18 @@ void TransactionInput::encode(Data& data) const {
     encode32LE(sequence, data);
 }
 
+size_t TransactionInput::witnessSize() const {
+    size_t size = varIntSize(scriptWitness.size());
+    for (auto& item : scriptWitness) {
+        size += varIntSize(item.size()) + item.size();
+    }
+    return size;
+}
+
 void TransactionInput::encodeWitness(Data& data) const {
     encodeVarInt(scriptWitness.size(), data);
     for (auto& item : scriptWitness) {
         encodeVarInt(item.size(), data);
-        std::copy(std::begin(item), std::end(item), std::back_inserter(data));
+        append(data, item);
     }
 }
@@ -37,6 +37,12 @@ class TransactionInput {
     TransactionInput(OutPoint previousOutput, Script script, uint32_t sequence)
         : previousOutput(std::move(previousOutput)), sequence(sequence), script(std::move(script)) {}
 
+    /// Size of the encoded input, without witness data, in bytes.
+    size_t size() const { return previousOutput.size() + script.size() + 4; }
+
+    /// Size of the encoded witness data, in bytes.
+    size_t witnessSize() const;
+
     /// Encodes the transaction into the provided buffer.
     void encode(Data& data) const;
 
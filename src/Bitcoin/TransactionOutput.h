@@ -29,6 +29,9 @@ struct TransactionOutput {
     /// Initializes a transaction output with a value and a script.
     TransactionOutput(Amount value, Script script) : value(value), script(std::move(script)) {}
 
+    /// Size of the encoded output, in bytes.
+    size_t size() const { return 8 + script.size(); }
+
     /// Encodes the output into the provided buffer.
     void encode(Data& data) const;
 };
@@ -0,0 +1,353 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "TransactionView.h"
+
+#include "../BinaryCoding.h"
+#include "../Hash.h"
+#include "../VarInt.h"
+
+#include <TrezorCrypto/blake256.h>
+#include <TrezorCrypto/sha2.h>
+
+#include <algorithm>
+
+using namespace TW;
+using namespace TW::Bitcoin;
+
+namespace {
+
+const uint32_t zcashOverwinteredFlag = 0x80000000;
+const uint32_t zcashSaplingVersion = 4;
+const uint32_t zcashSaplingVersionGroupId = 0x892F2085;
+const size_t zcashSpendDescriptionSize = 384;
+const size_t zcashOutputDescriptionSize = 948;
+const size_t zcashJoinSplitSize = 1698;
+const size_t zcashJoinSplitKeyAndSignatureSize = 32 + 64;
+const size_t zcashBindingSignatureSize = 64;
+
+const uint16_t decredSerializeFull = 0;
+const uint16_t decredSerializeNoWitness = 1;
+const uint16_t decredSerializeOnlyWitness = 2;
+
+/// Bounds-checked cursor over the raw bytes; any read past the end puts it in the failed state.
+class Reader {
+public:
+    Reader(const byte* data, size_t size) : data(data), size(size) {}
+
+    bool failed = false;
+
+    size_t position() const { return pos; }
+    size_t remaining() const { return size - pos; }
+    bool atEnd() const { return pos == size; }
+
+    ByteView view(size_t begin, size_t end) const { return ByteView{data + begin, end - begin}; }
+
+    ByteView take(size_t count) {
+        if (failed || count > remaining()) {
+            failed = true;
+            return ByteView{};
+        }
+        auto result = ByteView{data + pos, count};
+        pos += count;
+        return result;
+    }
+
+    uint8_t read8() {
+        auto bytes = take(1);
+        return failed ? 0 : bytes.data[0];
+    }
+
+    uint16_t read16() {
+        auto bytes = take(2);
+        return failed ? 0 : decode16LE(bytes.data);
+    }
+
+    uint32_t read32() {
+        auto bytes = take(4);
+        return failed ? 0 : decode32LE(bytes.data);
+    }
+
+    uint64_t read64() {
+        auto bytes = take(8);
+        return failed ? 0 : decode64LE(bytes.data);
+    }
+
+    uint64_t readVarInt() {
+        uint64_t value = 0;
+        if (failed || !VarInt::readCompactSize(data, size, pos, value)) {
+            failed = true;
+            return 0;
+        }
+        return value;
+    }
+
+    /// Reads an element count, failing if the elements could not possibly fit in the remaining bytes.
+    size_t readCount(size_t minElementSize) {
+        const auto count = readVarInt();
+        if (failed || count > remaining() / minElementSize) {
+            failed = true;
+            return 0;
+        }
+        return static_cast<size_t>(count);
+    }
+
+    ByteView readScript() {
+        const auto length = readVarInt();
+        if (failed || length > remaining()) {
+            failed = true;
+            return ByteView{};
+        }
+        return take(static_cast<size_t>(length));
+    }
+
+    void skip(size_t count) { take(count); }
+
+private:
+    const byte* data;
+    size_t size;
+    size_t pos = 0;
+};
+
+// outpoint, empty script, sequence
+const size_t minInputSize = 32 + 4 + 1 + 4;
+// value, empty script
+const size_t minOutputSize = 8 + 1;
+
+void readBitcoinInputsAndOutputs(Reader& reader, TransactionView& tx) {
+    tx.inputs.resize(reader.readCount(minInputSize));
+    for (auto& input : tx.inputs) {
+        input.previousHash = reader.take(32);
+        input.previousIndex = reader.read32();
+        input.script = reader.readScript();
+        input.sequence = reader.read32();
+    }
+    tx.outputs.resize(reader.readCount(minOutputSize));
+    for (auto& output : tx.outputs) {
+        output.value = static_cast<int64_t>(reader.read64());
+        output.script = reader.readScript();
+    }
+}
+
+bool parseBitcoin(Reader& reader, TransactionView& tx, ByteView& body) {
+    tx.version = static_cast<int32_t>(reader.read32());
+
+    // BIP144: a zero marker (which would be an empty input list) followed by a non-zero flag
+    bool segwit = false;
+    if (reader.remaining() >= 2 && tx.raw.data[reader.position()] == 0 && tx.raw.data[reader.position() + 1] != 0) {
+        if (tx.raw.data[reader.position() + 1] != 1) {
+            return false;
+        }
+        reader.skip(2);
+        segwit = true;
+    }
+
+    const auto bodyBegin = reader.position();
+    readBitcoinInputsAndOutputs(reader, tx);
+    body = reader.view(bodyBegin, reader.position());
+
+    if (segwit) {
+        for (auto& input : tx.inputs) {
+            input.witness.resize(reader.readCount(1));
+            for (auto& item : input.witness) {
+                item = reader.readScript();
+            }
+        }
+        // a segwit serialization without any witness data is invalid
+        if (!tx.hasWitness()) {
+            return false;
+        }
+    }
+
+    tx.lockTime = reader.read32();
+    return true;
+}
+
+bool parseZcashSapling(Reader& reader, TransactionView& tx) {
+    const auto header = reader.read32();
+    const auto versionGroupId = reader.read32();
+    if ((header & zcashOverwinteredFlag) == 0 || (header & ~zcashOverwinteredFlag) != zcashSaplingVersion ||
+        versionGroupId != zcashSaplingVersionGroupId) {
+        return false;
+    }
+    tx.version = static_cast<int32_t>(header);
+
+    readBitcoinInputsAndOutputs(reader, tx);
+    tx.lockTime = reader.read32();
+    tx.expiryHeight = reader.read32();
+    tx.valueBalance = static_cast<int64_t>(reader.read64());
+
+    // shielded data is skipped, only its framing is checked
+    const auto spends = reader.readCount(zcashSpendDescriptionSize);
+    reader.skip(spends * zcashSpendDescriptionSize);
+    const auto outputs = reader.readCount(zcashOutputDescriptionSize);
+    reader.skip(outputs * zcashOutputDescriptionSize);
+    const auto joinSplits = reader.readCount(zcashJoinSplitSize);
+    reader.skip(joinSplits * zcashJoinSplitSize);
+    if (joinSplits > 0) {
+        reader.skip(zcashJoinSplitKeyAndSignatureSize);
+    }
+    if (spends + outputs > 0) {
+        reader.skip(zcashBindingSignatureSize);
+    }
+    return true;
+}
+
+bool parseDecred(Reader& reader, TransactionView& tx, ByteView& body, ByteView& witnessSection) {
+    const auto header = reader.read32();
+    if (header >> 16 != decredSerializeFull) {
+        return false;
+    }
+    tx.version = static_cast<int32_t>(header & 0xffff);
+
+    const auto prefixBegin = reader.position();
+    // outpoint with tree, sequence
+    tx.inputs.resize(reader.readCount(32 + 4 + 1 + 4));
+    for (auto& input : tx.inputs) {
+        input.previousHash = reader.take(32);
+        input.previousIndex = reader.read32();
+        input.tree = reader.read8();
+        input.sequence = reader.read32();
+    }
+    // value, script version, empty script
+    tx.outputs.resize(reader.readCount(8 + 2 + 1));
+    for (auto& output : tx.outputs) {
+        output.value = static_cast<int64_t>(reader.read64());
+        output.scriptVersion = reader.read16();
+        output.script = reader.readScript();
+    }
+    tx.lockTime = reader.read32();
+    tx.expiryHeight = reader.read32();
+    body = reader.view(prefixBegin, reader.position());
+
+    const auto witnessBegin = reader.position();
+    // value, block height and index, empty script
+    if (reader.readCount(8 + 4 + 4 + 1) != tx.inputs.size()) {
+        return false;
+    }
+    for (auto& input : tx.inputs) {
+        input.valueIn = static_cast<int64_t>(reader.read64());
+        reader.skip(4 + 4);
+        input.script = reader.readScript();
+    }
+    witnessSection = reader.view(witnessBegin, reader.position());
+    return true;
+}
+
+Data blake256Section(int32_t version, uint16_t serializeType, const ByteView& section) {
+    byte header[4];
+    const auto value = static_cast<uint32_t>(version) | (static_cast<uint32_t>(serializeType) << 16);
+    header[0] = static_cast<byte>(value);
+    header[1] = static_cast<byte>(value >> 8);
+    header[2] = static_cast<byte>(value >> 16);
+    header[3] = static_cast<byte>(value >> 24);
+
+    BLAKE256_CTX context;
+    blake256_Init(&context);
+    blake256_Update(&context, header, sizeof(header));
+    blake256_Update(&context, section.data, section.size);
+    Data hash(BLAKE256_DIGEST_LENGTH);
+    blake256_Final(&context, hash.data());
+    return hash;
+}
+
+} // namespace
+
+std::optional<TransactionView> TransactionView::parse(const byte* data, size_t size, Format format) {
+    TransactionView tx;
+    tx.format = format;
+    tx.raw = ByteView{data, size};
+
+    Reader reader(data, size);
+    bool valid = false;
+    switch (format) {
+    case Bitcoin:
+        valid = parseBitcoin(reader, tx, tx.body);
+        break;
+    case ZcashSapling:
+        valid = parseZcashSapling(reader, tx);
+        break;
+    case Decred:
+        valid = parseDecred(reader, tx, tx.body, tx.witnessSection);
+        break;
+    }
+    if (!valid || reader.failed || !reader.atEnd()) {
+        return std::nullopt;
+    }
+    return tx;
+}
+
+bool TransactionView::hasWitness() const {
+    return std::any_of(inputs.begin(), inputs.end(), [](auto& input) { return !input.witness.empty(); });
+}
+
+Data TransactionView::hash() const {
+    switch (format) {
+    case Bitcoin: {
+        if (!hasWitness()) {
+            return Hash::sha256d(raw.data, raw.size);
+        }
+        // the non-witness serialization is the version, the inputs and outputs, and the lock time, all in place
+        SHA256_CTX context;
+        sha256_Init(&context);
+        sha256_Update(&context, raw.data, 4);
+        sha256_Update(&context, body.data, body.size);
+        sha256_Update(&context, raw.end() - 4, 4);
+        Data hash(SHA256_DIGEST_LENGTH);
+        sha256_Final(&context, hash.data());
+        return Hash::sha256(hash);
+    }
+    case ZcashSapling:
+        return Hash::sha256d(raw.data, raw.size);
+    case Decred:
+        return blake256Section(version, decredSerializeNoWitness, body);
+    }
+    return {};
+}
+
+Data TransactionView::witnessHash() const {
+    switch (format) {
+    case Bitcoin:
+    case ZcashSapling:
+        return Hash::sha256d(raw.data, raw.size);
+    case Decred: {
+        auto hashes = hash();
+        append(hashes, blake256Section(version, decredSerializeOnlyWitness, witnessSection));
+        return Hash::blake256(hashes);
+    }
+    }
+    return {};
+}
+
+std::optional<int64_t> TransactionView::outputValue(int64_t limit) const {
+    int64_t value = 0;
+    for (auto& output : outputs) {
+        // value and output.value are both in [0, limit], so this cannot overflow
+        if (output.value < 0 || output.value > limit - value) {
+            return std::nullopt;
+        }
+        value += output.value;
+    }
+    return value;
+}
+
+Transaction TransactionView::transaction() const {
+    auto tx = Transaction(version, lockTime);
+    tx.inputs.reserve(inputs.size());
+    for (auto& input : inputs) {
+        tx.inputs.emplace_back(OutPoint(input.previousHash, input.previousIndex), Script(input.script.begin(), input.script.end()), input.sequence);
+        auto& witness = tx.inputs.back().scriptWitness;
+        witness.reserve(input.witness.size());
+        for (auto& item : input.witness) {
+            witness.push_back(item.toData());
+        }
+    }
+    tx.outputs.reserve(outputs.size());
+    for (auto& output : outputs) {
+        tx.outputs.emplace_back(output.value, Script(output.script.begin(), output.script.end()));
+    }
+    return tx;
+}
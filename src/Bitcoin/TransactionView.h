@@ -0,0 +1,122 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "ByteView.h"
+#include "Transaction.h"
+#include "../Data.h"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace TW::Bitcoin {
+
+/// Input of a parsed raw transaction.
+struct TransactionInputView {
+    /// Hash of the referenced transaction, 32 bytes in internal byte order.
+    ByteView previousHash;
+
+    /// Index of the referenced output.
+    uint32_t previousIndex = 0;
+
+    /// Decred only: tree of the referenced output.
+    uint8_t tree = 0;
+
+    uint32_t sequence = 0;
+
+    /// Signature script (Decred: taken from the witness section).
+    ByteView script;
+
+    /// Segwit witness stack items.
+    std::vector<ByteView> witness;
+
+    /// Decred only: value of the referenced output, from the witness section.
+    int64_t valueIn = 0;
+};
+
+/// Output of a parsed raw transaction.
+struct TransactionOutputView {
+    int64_t value = 0;
+
+    /// Decred only: script version.
+    uint16_t scriptVersion = 0;
+
+    ByteView script;
+};
+
+/// Parsed raw transaction, referencing the scripts and witnesses in the raw bytes instead of copying them.
+/// A view must not outlive the buffer it was parsed from.
+class TransactionView {
+public:
+    /// Serialization framings understood by the parser.
+    enum Format {
+        /// Bitcoin and forks, with or without BIP144 segwit data.
+        Bitcoin,
+        /// Zcash version 4 (Sapling) transactions.
+        ZcashSapling,
+        /// Decred full serialization (prefix and witness).
+        Decred,
+    };
+
+    Format format = Bitcoin;
+
+    /// Version field; Zcash: header including the overwintered flag; Decred: version without serialization type.
+    int32_t version = 0;
+
+    uint32_t lockTime = 0;
+
+    /// Zcash and Decred only: expiry height.
+    uint32_t expiryHeight = 0;
+
+    /// Zcash only: net value of the shielded spends and outputs.
+    int64_t valueBalance = 0;
+
+    std::vector<TransactionInputView> inputs;
+    std::vector<TransactionOutputView> outputs;
+
+    /// The whole raw transaction.
+    ByteView raw;
+
+    /// Parses a raw transaction; returns nullopt if the bytes are malformed or have trailing data.
+    static std::optional<TransactionView> parse(const byte* data, size_t size, Format format = Bitcoin);
+    static std::optional<TransactionView> parse(const Data& data, Format format = Bitcoin) {
+        return parse(data.data(), data.size(), format);
+    }
+
+    /// Whether any input has segwit witness data.
+    bool hasWitness() const;
+
+    /// Transaction id in internal byte order (reverse it for display).
+    /// Bitcoin: sha256d of the non-witness serialization; Zcash: sha256d of the whole transaction;
+    /// Decred: blake256 of the prefix.
+    Data hash() const;
+
+    /// Hash committing to the witness data too, in internal byte order.
+    /// Bitcoin: wtxid; Zcash: same as hash(); Decred: full hash, blake256 of the prefix and witness hashes.
+    Data witnessHash() const;
+
+    /// Largest amount a transaction can move on Bitcoin (and Zcash, Decred): 21 million coins in satoshis.
+    static constexpr int64_t maxMoney = 21000000 * int64_t(100000000);
+
+    /// Sum of all output values; nullopt if any value or the sum is outside [0, limit].
+    /// Pass a higher limit for coins with a larger supply.
+    std::optional<int64_t> outputValue(int64_t limit = maxMoney) const;
+
+    /// Copies a Bitcoin-format view into an owning transaction.
+    Transaction transaction() const;
+
+private:
+    /// Bitcoin: inputs and outputs, between the version (and segwit marker) and the witnesses.
+    /// Decred: the prefix, after the version.
+    ByteView body;
+
+    /// Decred only: witness section, after the prefix.
+    ByteView witnessSection;
+};
+
+} // namespace TW::Bitcoin
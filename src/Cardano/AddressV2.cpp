@@ -18,12 +18,160 @@ using namespace TW;
 using namespace TW::Cardano;
 using namespace std;
 
+namespace {
+
+using TW::byte;
+
+// CBOR major types and headers used in Byron addresses
+constexpr byte MT_uint = 0;
+constexpr byte MT_bytes = 2;
+constexpr byte MT_array = 4;
+constexpr byte MT_map = 5;
+constexpr byte MT_tag = 6;
+constexpr byte CborEmptyMap = 0xa0;
+
+/// Minimal forward-only CBOR reader over a byte range, used for the fast path of address parsing.
+/// Supports definite-length items only; any failure means "not handled", and the caller falls back to Cbor::Decode.
+struct CborReader {
+    const byte* ptr;
+    const byte* end;
+
+    bool readHeader(byte& majorType, uint64_t& value) {
+        if (ptr >= end) { return false; }
+        const byte first = *ptr++;
+        majorType = first >> 5;
+        const byte minor = first & 0x1f;
+        if (minor < 24) {
+            value = minor;
+            return true;
+        }
+        if (minor > 27) {
+            // indefinite length or reserved
+            return false;
+        }
+        const size_t len = size_t(1) << (minor - 24);
+        if (size_t(end - ptr) < len) { return false; }
+        value = 0;
+        for (size_t i = 0; i < len; ++i) {
+            value = (value << 8) | *ptr++;
+        }
+        return true;
+    }
+
+    bool expect(byte majorType, uint64_t& value) {
+        byte mt;
+        return readHeader(mt, value) && mt == majorType;
+    }
+
+    bool readBytes(const byte*& begin, size_t& size) {
+        uint64_t len;
+        if (!expect(MT_bytes, len) || uint64_t(end - ptr) < len) { return false; }
+        begin = ptr;
+        size = static_cast<size_t>(len);
+        ptr += size;
+        return true;
+    }
+
+    /// Skips one complete item (with nested items)
+    bool skipItem(int depth = 0) {
+        if (depth > 16) { return false; }
+        byte mt;
+        uint64_t value;
+        if (!readHeader(mt, value)) { return false; }
+        switch (mt) {
+            case 2: // bytes
+            case 3: // string
+                if (uint64_t(end - ptr) < value) { return false; }
+                ptr += value;
+                return true;
+            case MT_array:
+                for (uint64_t i = 0; i < value; ++i) {
+                    if (!skipItem(depth + 1)) { return false; }
+                }
+                return true;
+            case MT_map:
+                for (uint64_t i = 0; i < 2 * value; ++i) {
+                    if (!skipItem(depth + 1)) { return false; }
+                }
+                return true;
+            case MT_tag:
+                return skipItem(depth + 1);
+            default: // uint, negint, simple
+                return true;
+        }
+    }
+};
+
+/// Size of a CBOR header encoding the given value, same minimal encoding as Cbor::Encode
+size_t cborHeaderSize(uint64_t value) {
+    if (value < 24) { return 1; }
+    if (value <= 0xff) { return 2; }
+    if (value <= 0xffff) { return 3; }
+    if (value <= 0xffffffff) { return 5; }
+    return 9;
+}
+
+/// Writes a CBOR header (major type and value) into the buffer, returns the position after it
+byte* writeCborHeader(byte majorType, uint64_t value, byte* out) {
+    const byte mt = static_cast<byte>(majorType << 5);
+    const auto size = cborHeaderSize(value);
+    if (size == 1) {
+        *out++ = mt | static_cast<byte>(value);
+        return out;
+    }
+    static const byte minors[] = {0, 24, 25, 0, 26, 0, 0, 0, 27};
+    *out++ = mt | minors[size - 1];
+    for (auto i = static_cast<int>(size) - 2; i >= 0; --i) {
+        *out++ = static_cast<byte>(value >> (8 * i));
+    }
+    return out;
+}
+
+/// Fast path for the common layout [tag24(bytes [root, attrs, type]), crc].
+/// Returns false if the layout is not recognized, throws if it is recognized but the CRC does not match.
+bool parseFast(const Data& raw, Data& root_out, Data& attrs_out, byte& type_out) {
+    CborReader outer{raw.data(), raw.data() + raw.size()};
+    uint64_t value;
+    if (!outer.expect(MT_array, value) || value != 2) { return false; }
+    if (!outer.expect(MT_tag, value) || value != AddressV2::PayloadTag) { return false; }
+    const byte* payload;
+    size_t payloadSize;
+    if (!outer.readBytes(payload, payloadSize)) { return false; }
+    uint64_t crcPresent;
+    if (!outer.expect(MT_uint, crcPresent) || outer.ptr != outer.end) { return false; }
+
+    CborReader inner{payload, payload + payloadSize};
+    if (!inner.expect(MT_array, value) || value != 3) { return false; }
+    const byte* root;
+    size_t rootSize;
+    if (!inner.readBytes(root, rootSize)) { return false; }
+    const byte* attrs = inner.ptr;
+    if (!inner.skipItem()) { return false; }
+    const byte* attrsEnd = inner.ptr;
+    uint64_t type;
+    if (!inner.expect(MT_uint, type) || inner.ptr != inner.end) { return false; }
+
+    if ((uint32_t)crcPresent != TW::Crc::crc32(payload, payloadSize)) {
+        throw invalid_argument("CRC mismatch");
+    }
+    root_out.assign(root, root + rootSize);
+    attrs_out.assign(attrs, attrsEnd);
+    type_out = (TW::byte)type;
+    return true;
+}
+
+} // namespace
+
 bool AddressV2::parseAndCheck(const std::string& addr, Data& root_out, Data& attrs_out, byte& type_out) {
     // Decode Bas58, decode payload + crc, decode root, attr
     Data base58decoded = Base58::bitcoin.decode(addr);
     if (base58decoded.size() == 0) {
         throw invalid_argument("Invalid address: could not Base58 decode");
     }
+    if (parseFast(base58decoded, root_out, attrs_out, type_out)) {
+        return true;
+    }
+    // uncommon layout, use the generic decoder
     auto elems = Cbor::Decode(base58decoded).getArrayElements();
     if (elems.size() < 2) {
         throw invalid_argument("Could not parse address payload from CBOR data");
@@ -77,28 +225,33 @@ AddressV2::AddressV2(const PublicKey& publicKey) {
     type = 0; // public key
     root = keyHash(publicKey.bytes);
     // address attributes: empty map for V2, for V1 encrypted derivation path
-    Cbor::Encode emptyMap = Cbor::Encode::map({});
-    attrs = emptyMap.encoded();
+    attrs = Data{CborEmptyMap};
 }
 
 Data AddressV2::getCborData() const {
-    // put together string represenatation, CBOR representation
-    // inner data: pubkey, attrs, type
-    auto cbor1 = Cbor::Encode::array({
-        Cbor::Encode::bytes(root),
-        Cbor::Encode::fromRaw(attrs),
-        Cbor::Encode::uint(type),
-    });
-    auto payloadData = cbor1.encoded();
-    
-    // crc checksum 
-    auto crc = TW::Crc::crc32(payloadData);
-    // second pack: tag, base, crc
-    auto cbor2 = Cbor::Encode::array({
-        Cbor::Encode::tag(PayloadTag, Cbor::Encode::bytes(payloadData)),
-        Cbor::Encode::uint(crc),
-    });
-    return cbor2.encoded();
+    // put together string represenatation, CBOR representation, written directly into one buffer
+    // inner data: [pubkey, attrs, type]
+    const auto payloadSize = 1 + cborHeaderSize(root.size()) + root.size() + attrs.size() + cborHeaderSize(type);
+    // outer data: [tag 24 (bytes payload), crc]
+    const auto payloadStart = 1 + cborHeaderSize(PayloadTag) + cborHeaderSize(payloadSize);
+    Data data(payloadStart + payloadSize + cborHeaderSize(0xffffffff));
+
+    byte* out = data.data();
+    out = writeCborHeader(MT_array, 2, out);
+    out = writeCborHeader(MT_tag, PayloadTag, out);
+    out = writeCborHeader(MT_bytes, payloadSize, out);
+    byte* payload = out;
+    out = writeCborHeader(MT_array, 3, out);
+    out = writeCborHeader(MT_bytes, root.size(), out);
+    out = std::copy(root.begin(), root.end(), out);
+    out = std::copy(attrs.begin(), attrs.end(), out);
+    out = writeCborHeader(MT_uint, type, out);
+
+    // crc checksum
+    const auto crc = TW::Crc::crc32(payload, payloadSize);
+    out = writeCborHeader(MT_uint, crc, out);
+    data.resize(out - data.data());
+    return data;
 }
 
 string AddressV2::string() const {
@@ -110,16 +263,11 @@ Data AddressV2::keyHash(const TW::Data& xpub) {
     if (xpub.size() != 64) { throw invalid_argument("invalid xbub length"); }
     // hash of follwoing Cbor-array: [0, [0, xbub], {} ]
     // 3rd entry map is empty map for V2, contains derivation path for V1
-    Data cborData = Cbor::Encode::array({
-        Cbor::Encode::uint(0),
-        Cbor::Encode::array({
-            Cbor::Encode::uint(0),
-            Cbor::Encode::bytes(xpub)
-        }),
-        Cbor::Encode::map({}),
-    }).encoded();
+    std::array<byte, 71> cborData = {0x83, 0x00, 0x82, 0x00, 0x58, 0x40};
+    std::copy(xpub.begin(), xpub.end(), cborData.begin() + 6);
+    cborData[70] = CborEmptyMap;
     // SHA3 hash, then blake
-    Data firstHash = Hash::sha3_256(cborData);
+    Data firstHash = Hash::sha3_256(cborData.data(), cborData.size());
     Data blake = Hash::blake2b(firstHash, 28);
     return blake;
 }
@@ -13,6 +13,7 @@
 #include "../Crc.h"
 #include "../HexCoding.h"
 #include "../Hash.h"
+#include "../HDWallet.h"
 
 #include <array>
 
@@ -20,63 +21,89 @@ using namespace TW;
 using namespace TW::Cardano;
 using namespace std;
 
+namespace {
+
+/// Max size of the packed address bytes: header byte, spending key, group key
+constexpr size_t MaxPackedSize = 1 + 32 + 32;
+using PackedBuffer = std::array<TW::byte, MaxPackedSize>;
+
+/// Decodes a V3 Bech32 address into a fixed buffer (header byte followed by the keys), without intermediate Data.
+/// Returns the number of bytes (33 or 65), or 0 if the address is not a valid V3 address.
+size_t decodePacked(const std::string& addr, PackedBuffer& packed) {
+    const auto bech = Bech32::decode(addr);
+    const auto& values = std::get<1>(bech);
+    if (values.size() == 0) {
+        // empty Bech data
+        return 0;
+    }
+    // Bech bits conversion, 5 to 8, no padding allowed (same rules as Bech32::convertBits<5, 8, false>)
+    size_t size = 0;
+    uint32_t acc = 0;
+    int bits = 0;
+    for (const auto value : values) {
+        acc = ((acc << 5) | value) & 0xfff;
+        bits += 5;
+        if (bits >= 8) {
+            bits -= 8;
+            if (size >= MaxPackedSize) {
+                return 0;
+            }
+            packed[size++] = static_cast<TW::byte>((acc >> bits) & 0xff);
+        }
+    }
+    if (bits >= 5 || ((acc << (8 - bits)) & 0xff) != 0) {
+        return 0;
+    }
+    if (size != 33 && size != 65) {
+        return 0;
+    }
+    const auto kind = (AddressV3::Kind)(packed[0] & 0b01111111);
+    if (kind <= AddressV3::Kind_Sentinel_Low || kind >= AddressV3::Kind_Sentinel_High) {
+        return 0;
+    }
+    if ((kind == AddressV3::Kind_Group) != (size == 65)) {
+        return 0;
+    }
+    return size;
+}
+
+/// Packs header byte and keys into a fixed buffer, returns the number of bytes used
+size_t encodePacked(const AddressV3& address, PackedBuffer& packed) {
+    TW::byte first = (TW::byte)address.kind;
+    if (address.discrimination == AddressV3::Discrim_Test) first = first | 0b10000000;
+    if (1 + address.key1.size() + address.groupKey.size() > MaxPackedSize) {
+        return 0;
+    }
+    packed[0] = first;
+    auto end = std::copy(address.key1.begin(), address.key1.end(), packed.begin() + 1);
+    end = std::copy(address.groupKey.begin(), address.groupKey.end(), end);
+    return end - packed.begin();
+}
+
+} // namespace
+
 bool AddressV3::parseAndCheckV3(const std::string& addr, Discrimination& discrimination, Kind& kind, Data& key1, Data& key2) {
     try {
-        auto bech = Bech32::decode(addr);
-        if (std::get<1>(bech).size() == 0) {
-            // empty Bech data
-            return false;
-        }
-        // Bech bits conversion
-        Data conv;
-        auto success = Bech32::convertBits<5, 8, false>(conv, std::get<1>(bech));
-        if (!success) {
-            return false;
-        }
-        if (conv.size() != 33 && conv.size() != 65) {
+        PackedBuffer packed;
+        const auto size = decodePacked(addr, packed);
+        if (size == 0) {
             return false;
         }
-        discrimination = (Discrimination)((conv[0] & 0b10000000) >> 7);
-        kind = (Kind)(conv[0] & 0b01111111);
-        if (kind <= Kind_Sentinel_Low || kind >= Kind_Sentinel_High) {
-            return false;
-        }
-        if ((kind == Kind_Group && conv.size() != 65) ||
-            (kind != Kind_Group && conv.size() != 33)) {
-            return false;
-        }
-
-        switch (kind) {
-            case Kind_Single:
-            case Kind_Account:
-            case Kind_Multisig:
-                assert(conv.size() == 33);
-                key1 = Data(32);
-                std::copy(conv.begin() + 1, conv.begin() + 33, key1.begin());
-                return true;
-
-            case Kind_Group:
-                assert(conv.size() == 65);
-                key1 = Data(32);
-                key2 = Data(32);
-                std::copy(conv.begin() + 1, conv.begin() + 33, key1.begin());
-                std::copy(conv.begin() + 33, conv.begin() + 65, key2.begin());
-                return true;
-
-            default:
-                return false;
+        discrimination = (Discrimination)((packed[0] & 0b10000000) >> 7);
+        kind = (Kind)(packed[0] & 0b01111111);
+        key1.assign(packed.begin() + 1, packed.begin() + 33);
+        if (kind == Kind_Group) {
+            key2.assign(packed.begin() + 33, packed.begin() + 65);
         }
+        return true;
     } catch (...) {
         return false;
     }
 }
 
 bool AddressV3::isValid(const std::string& addr) {
-    Discrimination discrimination;
-    Kind kind;
-    Data key1;
-    Data key2;
-    if (parseAndCheckV3(addr, discrimination, kind, key1, key2)) {
+    PackedBuffer packed;
+    if (decodePacked(addr, packed) != 0) {
         return true;
     }
     // not V3, try older
@@ -120,6 +147,16 @@ AddressV3 AddressV3::createAccount(Discrimination discrimination_in, const Data&
     return addr;
 }
 
+std::vector<AddressV3> AddressV3::createRange(const HDWallet& wallet, const DerivationPath& chain, uint32_t first, uint32_t count) {
+    const auto publicKeys = wallet.getPublicKeys(TWCoinTypeCardano, chain, first, count, false);
+    std::vector<AddressV3> addresses;
+    addresses.reserve(publicKeys.size());
+    for (const auto& publicKey : publicKeys) {
+        addresses.emplace_back(publicKey);
+    }
+    return addresses;
+}
+
 AddressV3::AddressV3(const std::string& addr) {
     if (parseAndCheckV3(addr, discrimination, kind, key1, groupKey)) {
         // values stored
@@ -200,18 +237,23 @@ string AddressV3::string(const std::string& hrp) const {
         return legacyAddressV2->string();
     }
 
-    byte first = (byte)kind;
-    if (discrimination == Discrim_Test) first = first | 0b10000000;
-    Data keys;
-    TW::append(keys, first);
-    TW::append(keys, key1);
-    if (groupKey.size() > 0) {
-        TW::append(keys, groupKey);
-    }
-    // bech
+    PackedBuffer packed;
+    const auto size = encodePacked(*this, packed);
+    // bech, 8 to 5 bits with padding
     Data bech;
-    if (!Bech32::convertBits<8, 5, true>(bech, keys)) {
-        return "";
+    bech.reserve((size * 8 + 4) / 5);
+    uint32_t acc = 0;
+    int bits = 0;
+    for (size_t i = 0; i < size; ++i) {
+        acc = ((acc << 8) | packed[i]) & 0xfff;
+        bits += 8;
+        while (bits >= 5) {
+            bits -= 5;
+            bech.push_back((acc >> bits) & 0x1f);
+        }
+    }
+    if (bits > 0) {
+        bech.push_back((acc << (5 - bits)) & 0x1f);
     }
     return Bech32::encode(hrp, bech, Bech32::ChecksumVariant::Bech32);
 }
@@ -8,10 +8,16 @@
 
 #include "AddressV2.h"
 #include "Data.h"
+#include "../DerivationPath.h"
 #include "../PublicKey.h"
 
 #include <string>
 #include <optional>
+#include <vector>
+
+namespace TW {
+class HDWallet;
+}
 
 namespace TW::Cardano {
 
@@ -54,6 +60,9 @@ class AddressV3 {
     static AddressV3 createGroup(Discrimination discrimination_in, const TW::Data& spendingKey, const TW::Data& groupKey);
     /// Create an account address
     static AddressV3 createAccount(Discrimination discrimination_in, const TW::Data& accountKey);
+    /// Create the addresses of the soft children chain/first ... chain/(first + count - 1) of a chain node,
+    /// e.g. m/1852'/1815'/0'/0, deriving the chain node once; the wallet caches its root.
+    static std::vector<AddressV3> createRange(const HDWallet& wallet, const DerivationPath& chain, uint32_t first, uint32_t count);
 
     /// Initializes a Cardano address with a string representation.  Throws if invalid.
     explicit AddressV3(const std::string& addr);
@@ -0,0 +1,164 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "ProtobufSerialization.h"
+
+#include "Address.h"
+#include "../Coin.h"
+#include "Protobuf/bank_tx.pb.h"
+#include "Protobuf/coin.pb.h"
+#include "Protobuf/crypto_secp256k1_keys.pb.h"
+#include "Protobuf/distribution_tx.pb.h"
+#include "Protobuf/staking_tx.pb.h"
+#include "Protobuf/thorchain_bank_tx.pb.h"
+#include "Protobuf/tx.pb.h"
+
+#include <TrustWalletCore/TWHRP.h>
+
+using namespace TW;
+using namespace TW::Cosmos;
+
+using string = std::string;
+
+/// Any type URLs are the full message names with a leading '/'
+static const auto TYPE_URL_PREFIX = "/";
+
+static cosmos::base::v1beta1::Coin convertCoin(const Proto::Amount& amount) {
+    cosmos::base::v1beta1::Coin coin;
+    coin.set_denom(amount.denom());
+    coin.set_amount(std::to_string(amount.amount()));
+    return coin;
+}
+
+static Data addressKeyHash(const string& address, TWCoinType coin) {
+    Address decoded;
+    if (!Bech32Address::decode(address, decoded, stringForHRP(TW::hrp(coin)))) {
+        throw Common::Proto::SigningError(Common::Proto::Error_invalid_address);
+    }
+    return decoded.getKeyHash();
+}
+
+static void packSend(const Proto::Message_Send& send, TWCoinType coin, google::protobuf::Any& any) {
+    if (coin == TWCoinTypeTHORChain) {
+        // THORChain's own bank module takes raw account bytes
+        auto msgSend = types::MsgSend();
+        const auto fromAddress = addressKeyHash(send.from_address(), coin);
+        const auto toAddress = addressKeyHash(send.to_address(), coin);
+        msgSend.set_from_address(fromAddress.data(), fromAddress.size());
+        msgSend.set_to_address(toAddress.data(), toAddress.size());
+        for (const auto& amount : send.amounts()) {
+            *msgSend.add_amount() = convertCoin(amount);
+        }
+        any.PackFrom(msgSend, TYPE_URL_PREFIX);
+        return;
+    }
+    auto msgSend = cosmos::bank::v1beta1::MsgSend();
+    msgSend.set_from_address(send.from_address());
+    msgSend.set_to_address(send.to_address());
+    for (const auto& amount : send.amounts()) {
+        *msgSend.add_amount() = convertCoin(amount);
+    }
+    any.PackFrom(msgSend, TYPE_URL_PREFIX);
+}
+
+static void packMessage(const Proto::Message& msg, TWCoinType coin, google::protobuf::Any& any) {
+    switch (msg.message_oneof_case()) {
+        case Proto::Message::kSendCoinsMessage:
+            packSend(msg.send_coins_message(), coin, any);
+            break;
+
+        case Proto::Message::kStakeMessage: {
+            const auto& stake = msg.stake_message();
+            auto msgDelegate = cosmos::staking::v1beta1::MsgDelegate();
+            msgDelegate.set_delegator_address(stake.delegator_address());
+            msgDelegate.set_validator_address(stake.validator_address());
+            *msgDelegate.mutable_amount() = convertCoin(stake.amount());
+            any.PackFrom(msgDelegate, TYPE_URL_PREFIX);
+            break;
+        }
+
+        case Proto::Message::kUnstakeMessage: {
+            const auto& unstake = msg.unstake_message();
+            auto msgUndelegate = cosmos::staking::v1beta1::MsgUndelegate();
+            msgUndelegate.set_delegator_address(unstake.delegator_address());
+            msgUndelegate.set_validator_address(unstake.validator_address());
+            *msgUndelegate.mutable_amount() = convertCoin(unstake.amount());
+            any.PackFrom(msgUndelegate, TYPE_URL_PREFIX);
+            break;
+        }
+
+        case Proto::Message::kRestakeMessage: {
+            const auto& restake = msg.restake_message();
+            auto msgRedelegate = cosmos::staking::v1beta1::MsgBeginRedelegate();
+            msgRedelegate.set_delegator_address(restake.delegator_address());
+            msgRedelegate.set_validator_src_address(restake.validator_src_address());
+            msgRedelegate.set_validator_dst_address(restake.validator_dst_address());
+            *msgRedelegate.mutable_amount() = convertCoin(restake.amount());
+            any.PackFrom(msgRedelegate, TYPE_URL_PREFIX);
+            break;
+        }
+
+        case Proto::Message::kWithdrawStakeRewardMessage: {
+            const auto& withdraw = msg.withdraw_stake_reward_message();
+            auto msgWithdraw = cosmos::distribution::v1beta1::MsgWithdrawDelegatorReward();
+            msgWithdraw.set_delegator_address(withdraw.delegator_address());
+            msgWithdraw.set_validator_address(withdraw.validator_address());
+            any.PackFrom(msgWithdraw, TYPE_URL_PREFIX);
+            break;
+        }
+
+        default:
+            // e.g. RawJSON, which has no protobuf representation
+            throw Common::Proto::SigningError(Common::Proto::Error_general);
+    }
+}
+
+string Cosmos::buildProtoTxBody(const Proto::SigningInput& input, TWCoinType coin) {
+    if (input.messages_size() == 0) {
+        throw Common::Proto::SigningError(Common::Proto::Error_general);
+    }
+    auto txBody = cosmos::tx::v1beta1::TxBody();
+    for (const auto& msg : input.messages()) {
+        packMessage(msg, coin, *txBody.add_messages());
+    }
+    txBody.set_memo(input.memo());
+    return txBody.SerializeAsString();
+}
+
+string Cosmos::buildAuthInfo(const Proto::SigningInput& input, const Data& publicKey) {
+    auto authInfo = cosmos::tx::v1beta1::AuthInfo();
+    auto* signerInfo = authInfo.add_signer_infos();
+
+    auto pubKey = cosmos::crypto::secp256k1::PubKey();
+    pubKey.set_key(publicKey.data(), publicKey.size());
+    signerInfo->mutable_public_key()->PackFrom(pubKey, TYPE_URL_PREFIX);
+    signerInfo->mutable_mode_info()->mutable_single()->set_mode(cosmos::tx::v1beta1::SIGN_MODE_DIRECT);
+    signerInfo->set_sequence(input.sequence());
+
+    auto* fee = authInfo.mutable_fee();
+    for (const auto& amount : input.fee().amounts()) {
+        *fee->add_amount() = convertCoin(amount);
+    }
+    fee->set_gas_limit(input.fee().gas());
+    return authInfo.SerializeAsString();
+}
+
+string Cosmos::signaturePreimageProto(const Proto::SigningInput& input, const string& serializedTxBody, const string& serializedAuthInfo) {
+    auto signDoc = cosmos::tx::v1beta1::SignDoc();
+    signDoc.set_body_bytes(serializedTxBody);
+    signDoc.set_auth_info_bytes(serializedAuthInfo);
+    signDoc.set_chain_id(input.chain_id());
+    signDoc.set_account_number(input.account_number());
+    return signDoc.SerializeAsString();
+}
+
+string Cosmos::buildProtoTxRaw(const string& serializedTxBody, const string& serializedAuthInfo, const Data& signature) {
+    auto txRaw = cosmos::tx::v1beta1::TxRaw();
+    txRaw.set_body_bytes(serializedTxBody);
+    txRaw.set_auth_info_bytes(serializedAuthInfo);
+    txRaw.add_signatures(signature.data(), signature.size());
+    return txRaw.SerializeAsString();
+}
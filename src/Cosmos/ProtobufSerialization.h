@@ -0,0 +1,31 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "../proto/Cosmos.pb.h"
+#include "Data.h"
+#include <TrustWalletCore/TWCoinType.h>
+
+#include <string>
+
+namespace TW::Cosmos {
+
+/// Serialized cosmos.tx.v1beta1.TxBody with all messages packed as Any.
+/// Throws Common::Proto::SigningError for messages that have no protobuf representation (e.g. RawJSON)
+/// and for THORChain addresses with a foreign HRP.
+std::string buildProtoTxBody(const Proto::SigningInput& input, TWCoinType coin);
+
+/// Serialized cosmos.tx.v1beta1.AuthInfo with a single SIGN_MODE_DIRECT signer and the fee.
+std::string buildAuthInfo(const Proto::SigningInput& input, const Data& publicKey);
+
+/// Serialized cosmos.tx.v1beta1.SignDoc, whose SHA-256 is signed in SIGN_MODE_DIRECT.
+std::string signaturePreimageProto(const Proto::SigningInput& input, const std::string& serializedTxBody, const std::string& serializedAuthInfo);
+
+/// Serialized cosmos.tx.v1beta1.TxRaw, ready for broadcast.
+std::string buildProtoTxRaw(const std::string& serializedTxBody, const std::string& serializedAuthInfo, const Data& signature);
+
+} // namespace
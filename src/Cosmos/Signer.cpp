@@ -7,6 +7,7 @@
 #include "Signer.h"
 #include "PrivateKey.h"
 #include "Serialization.h"
+#include "ProtobufSerialization.h"
 
 #include "Data.h"
 #include "Hash.h"
@@ -16,7 +17,18 @@
 using namespace TW;
 using namespace TW::Cosmos;
 
-Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
+Proto::SigningOutput Signer::sign(const Proto::SigningInput& input, TWCoinType coin) noexcept {
+    switch (input.signing_mode()) {
+        case Proto::Protobuf:
+            return signProtobuf(input, coin);
+
+        case Proto::JSON:
+        default:
+            return signJsonSerialized(input);
+    }
+}
+
+Proto::SigningOutput Signer::signJsonSerialized(const Proto::SigningInput& input) noexcept {
     auto key = PrivateKey(input.private_key());
     auto preimage = signaturePreimage(input).dump();
     auto hash = Hash::sha256(preimage);
@@ -30,10 +42,37 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     return output;
 }
 
+Proto::SigningOutput Signer::signProtobuf(const Proto::SigningInput& input, TWCoinType coin) noexcept {
+    auto output = Proto::SigningOutput();
+    if (!PrivateKey::isValid(Data(input.private_key().begin(), input.private_key().end()), TWCurveSECP256k1)) {
+        output.set_error(Common::Proto::Error_missing_private_key);
+        return output;
+    }
+    try {
+        const auto privateKey = PrivateKey(input.private_key());
+        const auto publicKey = privateKey.getPublicKey(TWPublicKeyTypeSECP256k1);
+        const auto serializedTxBody = buildProtoTxBody(input, coin);
+        const auto serializedAuthInfo = buildAuthInfo(input, publicKey.bytes);
+        const auto preimage = signaturePreimageProto(input, serializedTxBody, serializedAuthInfo);
+        const auto hash = Hash::sha256(preimage);
+        const auto signedHash = privateKey.sign(hash, TWCurveSECP256k1);
+        const auto signature = Data(signedHash.begin(), signedHash.end() - 1);
+
+        const auto txRaw = buildProtoTxRaw(serializedTxBody, serializedAuthInfo, signature);
+        output.set_serialized(txRaw);
+        output.set_signature(signature.data(), signature.size());
+    } catch (const Common::Proto::SigningError& error) {
+        output.set_error(error);
+    } catch (const std::exception&) {
+        output.set_error(Common::Proto::Error_internal);
+    }
+    return output;
+}
+
 std::string Signer::signJSON(const std::string& json, const Data& key) {
     auto input = Proto::SigningInput();
     google::protobuf::util::JsonStringToMessage(json, &input);
     input.set_private_key(key.data(), key.size());
-    auto output = Signer::sign(input);
+    auto output = Signer::signJsonSerialized(input);
     return output.json();
 }
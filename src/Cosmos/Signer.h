@@ -8,15 +8,23 @@
 
 #include "../Data.h"
 #include "../proto/Cosmos.pb.h"
+#include <TrustWalletCore/TWCoinType.h>
 
 namespace TW::Cosmos {
 
 /// Helper class that performs Cosmos transaction signing.
 class Signer {
   public:
-    /// Signs a Proto::SigningInput transaction
-    static Proto::SigningOutput sign(const Proto::SigningInput& input) noexcept;
-    /// Signs a json Proto::SigningInput with private key
+    /// Signs a Proto::SigningInput transaction, using the signing mode requested in the input
+    static Proto::SigningOutput sign(const Proto::SigningInput& input, TWCoinType coin) noexcept;
+
+    /// Signs a Proto::SigningInput transaction, using Amino JSON serialization
+    static Proto::SigningOutput signJsonSerialized(const Proto::SigningInput& input) noexcept;
+
+    /// Signs a Proto::SigningInput transaction, using protobuf serialization (SIGN_MODE_DIRECT)
+    static Proto::SigningOutput signProtobuf(const Proto::SigningInput& input, TWCoinType coin) noexcept;
+
+    /// Signs a json Proto::SigningInput with private key, using Amino JSON serialization
     static std::string signJSON(const std::string& json, const Data& key);
 };
 
@@ -6,37 +6,197 @@
 
 #include "Crc.h"
 
-#include <boost/crc.hpp>  // for boost::crc_32_type
+#include <boost/crc.hpp>  // for boost::crc_optimal
 
+#include <array>
 #include <string>
 
+#if defined(__x86_64__) || defined(__i386__)
+#define TW_CRC32_PCLMUL 1
+#include <immintrin.h>
+#endif
+
 using namespace TW;
 
-uint16_t Crc::crc16(uint8_t* bytes, uint32_t length) {
-    // Calculate checksum for existing bytes
-    uint16_t crc = 0x0000;
-    const uint16_t polynomial = 0x1021;
-
-    for (auto i = 0; i < length; i++) {
-        const auto byte = bytes[i];
-        for (auto bitidx = 0; bitidx < 8; bitidx++) {
-            const auto bit = ((byte >> (7 - bitidx) & 1) == 1);
-            const auto c15 = ((crc >> 15 & 1) == 1);
-            crc <<= 1;
-            if (c15 ^ bit) {
-                crc ^= polynomial;
-            }
+namespace {
+
+/// Lookup table for the CRC16-XMODEM polynomial 0x1021 (MSB first), one entry per byte value
+constexpr std::array<uint16_t, 256> crc16Table() {
+    std::array<uint16_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint16_t c = static_cast<uint16_t>(i << 8);
+        for (auto bit = 0; bit < 8; ++bit) {
+            c = (c & 0x8000) ? static_cast<uint16_t>((c << 1) ^ 0x1021) : static_cast<uint16_t>(c << 1);
+        }
+        table[i] = c;
+    }
+    return table;
+}
+
+/// Slicing-by-8 tables for the reflected CRC32 polynomial 0xEDB88320.
+/// Table 0 is the classic byte-at-a-time table, table k advances a byte through k further zero bytes.
+constexpr std::array<std::array<uint32_t, 256>, 8> crc32Tables() {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (auto bit = 0; bit < 8; ++bit) {
+            c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+        }
+        tables[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+        for (auto k = 1; k < 8; ++k) {
+            const auto previous = tables[k - 1][i];
+            tables[k][i] = (previous >> 8) ^ tables[0][previous & 0xFF];
         }
     }
+    return tables;
+}
+
+constexpr auto crc16Lookup = crc16Table();
+constexpr auto crc32Lookup = crc32Tables();
 
-    return crc & 0xffff;
+inline uint32_t load32LE(const byte* p) {
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+/// Updates a (pre-inverted) CRC32 state, 8 bytes per step
+uint32_t crc32SliceBy8(uint32_t crc, const byte* data, size_t size) {
+    const auto& t = crc32Lookup;
+    while (size >= 8) {
+        const auto one = load32LE(data) ^ crc;
+        const auto two = load32LE(data + 4);
+        crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+              t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+        data += 8;
+        size -= 8;
+    }
+    while (size-- > 0) {
+        crc = t[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#ifdef TW_CRC32_PCLMUL
+
+/// Folds a (pre-inverted) CRC32 state over size bytes using carry-less multiplication.
+/// Requires size >= 64 and a multiple of 16.
+/// Based on "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009),
+/// with the constants of the bit-reflected CRC32 domain as used by zlib and Chromium.
+__attribute__((target("pclmul,sse4.1")))
+uint32_t crc32FoldPclmul(uint32_t crc, const byte* data, size_t size) {
+    alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+    alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+    auto x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+    auto x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+    auto x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+    auto x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    auto x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    data += 64;
+    size -= 64;
+
+    // Fold four 128-bit lanes in parallel
+    while (size >= 64) {
+        const auto x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        const auto x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        const auto x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        const auto x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+        data += 64;
+        size -= 64;
+    }
+
+    // Fold the four lanes into one
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+    for (const auto& next : {x2, x3, x4}) {
+        const auto x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, next), x5);
+    }
+
+    // Fold the remaining 16-byte blocks
+    while (size >= 16) {
+        const auto x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data))), x5);
+        data += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x00), x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+uint32_t crc32Pclmul(uint32_t crc, const byte* data, size_t size) {
+    if (size >= 64) {
+        const auto folded = size & ~size_t(15);
+        crc = crc32FoldPclmul(crc, data, folded);
+        data += folded;
+        size -= folded;
+    }
+    return crc32SliceBy8(crc, data, size);
+}
+
+#endif // TW_CRC32_PCLMUL
+
+using Crc32Function = uint32_t (*)(uint32_t crc, const byte* data, size_t size);
+
+/// Picks the fastest CRC32 implementation supported by the CPU
+Crc32Function selectCrc32() {
+#ifdef TW_CRC32_PCLMUL
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+        return crc32Pclmul;
+    }
+#endif
+    return crc32SliceBy8;
+}
+
+} // namespace
+
+uint16_t Crc::crc16(uint8_t* bytes, uint32_t length) {
+    // CRC16-XMODEM: polynomial 0x1021, initial value 0x0000, no reflection
+    uint16_t crc = 0x0000;
+    for (uint32_t i = 0; i < length; ++i) {
+        crc = static_cast<uint16_t>((crc << 8) ^ crc16Lookup[((crc >> 8) ^ bytes[i]) & 0xFF]);
+    }
+    return crc;
 }
 
 uint32_t Crc::crc32(const Data& data)
 {
-    boost::crc_32_type result;
-    result.process_bytes((const void*)data.data(), data.size());
-    return (uint32_t)result.checksum();
+    return crc32(data.data(), data.size());
+}
+
+uint32_t Crc::crc32(const byte* data, size_t size)
+{
+    static const auto implementation = selectCrc32();
+    return implementation(0xFFFFFFFF, data, size) ^ 0xFFFFFFFF;
 }
 
 uint32_t Crc::crc32C(const Data& data)
@@ -10,13 +10,15 @@
 
 namespace TW::Crc {
 
-/// CRC16 implementation compatible with the Stellar version
-/// Ported from this implementation: http://introcs.cs.princeton.edu/java/61data/CRC16CCITT.java.html
-/// Initial value changed to 0x0000 to match Stellar
+/// CRC16 implementation compatible with the Stellar version (CRC16-XMODEM: polynomial 0x1021, initial value 0x0000), table-driven
 uint16_t crc16(uint8_t* bytes, uint32_t length);
 
 uint32_t crc32(const TW::Data& data);
 
+/// CRC32 (IEEE 802.3, reflected, as used by zlib and Cardano Byron addresses).
+/// Uses PCLMULQDQ folding on x86 CPUs that support it and slicing-by-8 otherwise.
+uint32_t crc32(const TW::byte* data, size_t size);
+
 uint32_t crc32C(const TW::Data& data);
 
 } // namespace TW::Crc
@@ -4,6 +4,7 @@
 
 #include "../Data.h"
 #include "../BinaryCoding.h"
+#include "../VarInt.h"
 
 #include <vector>
 #include <set>
@@ -11,26 +12,7 @@
 
 namespace TW::EOS {
 inline void encodeVarInt64(uint64_t x, Data& os) {
-    // 64-bit int would take at most 10 bytes as a varint
-    static const int maxBytes = 10;
-    uint8_t bytes[maxBytes];
-
-    int lastNonZeroByte = 0;
-    for (int i = 0; i < maxBytes; ++i) {
-        bytes[i] = (x & 0x7F);
-        if (bytes[i]) {
-            lastNonZeroByte = i;
-        }
-
-        // set the first bit
-        bytes[i] |= 0x80;
-        x >>= 7;
-    }
-
-    // unset the first bit of the last byte
-    bytes[lastNonZeroByte] &= 0x7F;
-
-    os.insert(os.end(), bytes, bytes + lastNonZeroByte + 1);
+    VarInt::appendLEB128(x, os);
 }
 
 inline void encodeVarInt32(uint32_t x, Data& os) {
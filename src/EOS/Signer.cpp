@@ -57,10 +57,17 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
         auto chainId = Data(input.chain_id().begin(), input.chain_id().end());
         Signer(chainId).sign(key, type, tx);
 
-        // Pack the transaction and add the json encoding to Signing outputput
+        // Pack the transaction and add the binary and json encodings to Signing output
         PackedTransaction ptx{tx, CompressionType::None};
 
-        output.set_json_encoded(ptx.serialize().dump());
+        if (input.output_format() != Common::Proto::Output_json) {
+            Data encoded;
+            ptx.serialize(encoded);
+            output.set_encoded(encoded.data(), encoded.size());
+        }
+        if (input.output_format() != Common::Proto::Output_raw) {
+            output.set_json_encoded(ptx.serialize().dump());
+        }
         return output;
     } catch (const std::exception& e) {
         output.set_error(Common::Proto::Error_internal);
@@ -11,58 +11,94 @@
 #include "Base64.h"
 #include "PrivateKey.h"
 
+#include <algorithm>
+#include <charconv>
+
 using namespace TW;
 
-std::map<string, int> fields_order {
-    {"nonce", 1},
-    {"value", 2},
-    {"receiver", 3},
-    {"sender", 4},
-    {"gasPrice", 5},
-    {"gasLimit", 6},
-    {"data", 7},
-    {"chainID", 8},
-    {"version", 9},
-    {"signature", 10}
-};
+namespace {
 
-struct FieldsSorter {
-    bool operator() (const string& lhs, const string& rhs) const {
-        return fields_order[lhs] < fields_order[rhs]; 
+/// Writes the transaction JSON with keys in the order the protocol signs them (nonce, value, receiver, sender,
+/// gasPrice, gasLimit, data, chainID, version, signature), byte-for-byte what nlohmann's dump() produces.
+class PayloadWriter {
+  public:
+    explicit PayloadWriter(std::size_t capacity) { out.reserve(capacity); }
+
+    void key(const char* name) {
+        out += first ? "{\"" : ",\"";
+        out += name;
+        out += "\":";
+        first = false;
     }
-};
 
-template<class Key, class T, class Compare, class Allocator>
-using sorted_map = std::map<Key, T, FieldsSorter, Allocator>;
-using sorted_json = nlohmann::basic_json<sorted_map>;
-
-sorted_json preparePayload(const Elrond::Proto::TransactionMessage& message) {
-    sorted_json payload {
-        {"nonce", json(message.nonce())},
-        {"value", json(message.value())},
-        {"receiver", json(message.receiver())},
-        {"sender", json(message.sender())},
-        {"gasPrice", json(message.gas_price())},
-        {"gasLimit", json(message.gas_limit())},
-    };
-
-    if (!message.data().empty()) {
-        payload["data"] = json(TW::Base64::encode(TW::data(message.data())));
+    void number(uint64_t value) {
+        char buffer[20];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
     }
 
-    payload["chainID"] = json(message.chain_id());
-    payload["version"] = json(message.version());
+    void text(const string& value) {
+        const auto plain = std::all_of(value.begin(), value.end(), [](char c) {
+            return c >= 0x20 && c < 0x7f && c != '"' && c != '\\';
+        });
+        if (!plain) {
+            // escaping and UTF-8 validation are left to nlohmann
+            out += json(value).dump();
+            return;
+        }
+        out += '"';
+        out += value;
+        out += '"';
+    }
+
+    string finish() {
+        out += '}';
+        return std::move(out);
+    }
 
-    return payload;
+  private:
+    string out;
+    bool first = true;
+};
+
+string preparePayload(const Elrond::Proto::TransactionMessage& message, const string* signature) {
+    const auto encodedData = message.data().empty() ? string() : Base64::encode(TW::data(message.data()));
+    PayloadWriter writer(160 + message.value().size() + message.receiver().size() + message.sender().size() +
+                         encodedData.size() + message.chain_id().size() + (signature ? signature->size() : 0));
+
+    writer.key("nonce");
+    writer.number(message.nonce());
+    writer.key("value");
+    writer.text(message.value());
+    writer.key("receiver");
+    writer.text(message.receiver());
+    writer.key("sender");
+    writer.text(message.sender());
+    writer.key("gasPrice");
+    writer.number(message.gas_price());
+    writer.key("gasLimit");
+    writer.number(message.gas_limit());
+    if (!encodedData.empty()) {
+        writer.key("data");
+        writer.text(encodedData);
+    }
+    writer.key("chainID");
+    writer.text(message.chain_id());
+    writer.key("version");
+    writer.number(message.version());
+    if (signature != nullptr) {
+        writer.key("signature");
+        writer.text(*signature);
+    }
+    return writer.finish();
 }
 
+} // namespace
+
 string Elrond::serializeTransaction(const Proto::TransactionMessage& message) {
-    sorted_json payload = preparePayload(message);
-    return payload.dump();
+    return preparePayload(message, nullptr);
 }
 
 string Elrond::serializeSignedTransaction(const Proto::TransactionMessage& message, string signature) {
-    sorted_json payload = preparePayload(message);
-    payload["signature"] = json(signature);
-    return payload.dump();
+    return preparePayload(message, &signature);
 }
@@ -21,11 +21,14 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput &input) noexcept {
     auto signableAsData = TW::data(signableAsString);
     auto signature = privateKey.sign(signableAsData, TWCurveED25519);
     auto encodedSignature = hex(signature);
-    auto encoded = serializeSignedTransaction(input.transaction(), encodedSignature);
 
     auto protoOutput = Proto::SigningOutput();
-    protoOutput.set_signature(encodedSignature);
-    protoOutput.set_encoded(encoded);
+    if (input.output_format() != Common::Proto::Output_raw) {
+        protoOutput.set_encoded(serializeSignedTransaction(input.transaction(), encodedSignature));
+    }
+    if (input.output_format() != Common::Proto::Output_json) {
+        protoOutput.set_signature(std::move(encodedSignature));
+    }
     return protoOutput;
 }
 
@@ -9,6 +9,7 @@
 #include "../Data.h"
 #include "../uint256.h"
 #include "../BinaryCoding.h"
+#include "../VarInt.h"
 
 #include <tuple>
 
@@ -51,24 +52,14 @@ Data RLP::encodeHeader(uint64_t size, uint8_t smallTag, uint8_t largeTag) noexce
         return {static_cast<uint8_t>(smallTag + size)};
     }
 
-    const auto sizeData = putVarInt(size);
-
-    auto header = Data();
-    header.reserve(1 + sizeData.size());
-    header.push_back(largeTag + static_cast<uint8_t>(sizeData.size()));
-    header.insert(header.end(), sizeData.begin(), sizeData.end());
+    auto header = Data(1 + VarInt::bigEndianLength(size));
+    header[0] = largeTag + static_cast<uint8_t>(VarInt::writeBigEndian(size, header.data() + 1));
     return header;
 }
 
 Data RLP::putVarInt(uint64_t i) noexcept {
-    Data bytes; // accumulate bytes here, in reverse order
-    do {
-        // take LSB byte, append 
-        bytes.push_back(i & 0xff);
-        i = i >> 8;
-    } while (i);
-    assert(bytes.size() >= 1 && bytes.size() <= 8);
-    std::reverse(bytes.begin(), bytes.end());
+    auto bytes = Data(VarInt::bigEndianLength(i));
+    VarInt::writeBigEndian(i, bytes.data());
     return bytes;
 }
 
@@ -10,11 +10,13 @@
 #include "../Encrypt.h"
 #include "../Hash.h"
 #include "../HexCoding.h"
+#include "../Parallel.h"
 #include "../PrivateKey.h"
 #include "../PublicKey.h"
 
 #include <TrezorCrypto/rand.h>
 #include <TrezorCrypto/ecdsa.h>
+#include <TrezorCrypto/memzero.h>
 #include <TrezorCrypto/secp256k1.h>
 #include <TrustWalletCore/TWAESPaddingMode.h>
 
@@ -91,7 +93,9 @@ Data Encryption::getSharedSecret(const PrivateKey& privateKey1, const PublicKey&
     // See https://github.com/fioprotocol/fiojs/blob/master/src/ecc/key_private.js
     
     curve_point KBP;
-	assert(ecdsa_read_pubkey(&secp256k1, publicKey2.bytes.data(), &KBP));
+    if (ecdsa_read_pubkey(&secp256k1, publicKey2.bytes.data(), &KBP) == 0) {
+        throw std::invalid_argument("Invalid public key");
+    }
 
     bignum256 privBN;
     bn_read_be(privateKey1.bytes.data(), &privBN);
@@ -125,4 +129,46 @@ Data Encryption::decode(const std::string& encoded) {
     return TW::Base64::decode(encoded);
 }
 
+Decryptor::~Decryptor() {
+    for (auto& secret : secrets) {
+        memzero(secret.second.data(), secret.second.size());
+    }
+}
+
+Data Decryptor::sharedSecret(const PublicKey& publicKey) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto found = secrets.find(publicKey.bytes);
+        if (found != secrets.end()) {
+            return found->second;
+        }
+    }
+    // derived outside the lock; concurrent first uses of a key may both derive it
+    auto secret = Encryption::getSharedSecret(privateKey, publicKey);
+    std::lock_guard<std::mutex> lock(mutex);
+    secrets.emplace(publicKey.bytes, secret);
+    return secret;
+}
+
+Data Decryptor::decrypt(const PublicKey& sender, const Data& encrypted) {
+    return Encryption::checkDecrypt(sharedSecret(sender), encrypted);
+}
+
+std::vector<std::optional<Data>> Decryptor::decryptAll(const std::vector<EncodedMessage>& messages) {
+    std::vector<std::optional<Data>> results(messages.size());
+    parallelFor(messages.size(), [&](size_t i) {
+        try {
+            results[i] = decrypt(messages[i].first, Encryption::decode(messages[i].second));
+        } catch (...) {
+            // left empty
+        }
+    });
+    return results;
+}
+
+std::size_t Decryptor::cachedSecrets() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return secrets.size();
+}
+
 } // namespace TW::FIO
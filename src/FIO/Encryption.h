@@ -10,6 +10,13 @@
 #include "../PrivateKey.h"
 #include "../PublicKey.h"
 
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace TW::FIO {
 
 /// Payload message encryption/decryption.
@@ -54,4 +61,38 @@ public:
     static Data decode(const std::string& encoded);
 };
 
+/// Decrypts the messages received by one private key, such as the funds requests and OBT records of an inbox.
+/// The shared secret of each counterparty public key is derived once and kept, wiped on destruction.
+/// A decryptor may be used from several threads.
+class Decryptor {
+public:
+    /// Sender public key and Base64-encoded encrypted content, as found in a FIO request.
+    using EncodedMessage = std::pair<PublicKey, std::string>;
+
+    explicit Decryptor(PrivateKey privateKey) : privateKey(std::move(privateKey)) {}
+    ~Decryptor();
+
+    Decryptor(const Decryptor&) = delete;
+    Decryptor& operator=(const Decryptor&) = delete;
+
+    /// Shared secret with a counterparty, see Encryption::getSharedSecret.
+    /// @throws std::invalid_argument if the public key is not a valid secp256k1 point.
+    Data sharedSecret(const PublicKey& publicKey);
+
+    /// Decrypt a message from a sender, see Encryption::decrypt.
+    Data decrypt(const PublicKey& sender, const Data& encrypted);
+
+    /// Decode and decrypt many messages in parallel.  A message that cannot be decoded, authenticated or decrypted
+    /// yields nullopt, without affecting the others.
+    std::vector<std::optional<Data>> decryptAll(const std::vector<EncodedMessage>& messages);
+
+    /// Number of counterparties with a cached shared secret.
+    std::size_t cachedSecrets();
+
+private:
+    PrivateKey privateKey;
+    std::mutex mutex;
+    std::map<Data, Data> secrets;
+};
+
 } // namespace TW::FIO
@@ -8,6 +8,7 @@
 
 #include "../Base32.h"
 #include "../Data.h"
+#include "../VarInt.h"
 
 using namespace TW;
 using namespace TW::Filecoin;
@@ -24,19 +25,9 @@ bool Address::isValid(const Data& data) {
         return false;
     } else if (type == Type::ID) {
         // Verify varuint encoding
-        if (data.size() > 11) {
-            return false;
-        }
-        if (data.size() == 11 && data[10] > 0x01) {
-            return false;
-        }
-        int i;
-        for (i = 1; i < data.size(); i++) {
-            if ((data[i] & 0x80) == 0) {
-                break;
-            }
-        }
-        return i == data.size() - 1;
+        size_t index = 1;
+        uint64_t id = 0;
+        return VarInt::readLEB128(data.data(), data.size(), index, id) && index == data.size();
     } else {
         return data.size() == (1 + Address::payloadSize(type));
     }
@@ -108,12 +99,7 @@ Address::Address(const std::string& string) {
     // First byte is type
     bytes.push_back(static_cast<uint8_t>(type));
     if (type == Type::ID) {
-        uint64_t id = std::stoull(string.substr(2));
-        while (id >= 0x80) {
-            bytes.push_back(((uint8_t)id) | 0x80);
-            id >>= 7;
-        }
-        bytes.push_back((uint8_t)id);
+        VarInt::appendLEB128(std::stoull(string.substr(2)), bytes);
         return;
     }
 
@@ -146,17 +132,9 @@ std::string Address::string() const {
     s.push_back(typeAscii(type()));
 
     if (type() == Type::ID) {
+        size_t index = 1;
         uint64_t id = 0;
-        unsigned shift = 0;
-        for (int i = 1; i < bytes.size(); i++) {
-            if (bytes[i] < 0x80) {
-                id |= bytes[i] << shift;
-                break;
-            } else {
-                id |= ((uint64_t)(bytes[i] & 0x7F)) << shift;
-                shift += 7;
-            }
-        }
+        VarInt::readLEB128(bytes.data(), bytes.size(), index, id);
         s.append(std::to_string(id));
         return s;
     }
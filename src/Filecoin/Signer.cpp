@@ -29,11 +29,16 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
 
     // Sign transaction.
     auto signature = sign(key, transaction);
-    const auto json = transaction.serialize(signature);
 
     // Return Protobuf output.
     Proto::SigningOutput output;
-    output.set_json(json.data(), json.size());
+    if (input.output_format() != Common::Proto::Output_json) {
+        output.set_signature(signature.data(), signature.size());
+    }
+    if (input.output_format() != Common::Proto::Output_raw) {
+        const auto json = transaction.serialize(signature);
+        output.set_json(json.data(), json.size());
+    }
     return output;
 }
 
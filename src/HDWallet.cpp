@@ -12,6 +12,7 @@
 #include "Bitcoin/CashAddress.h"
 #include "Coin.h"
 #include "Mnemonic.h"
+#include "Parallel.h"
 
 #include <TrustWalletCore/TWHRP.h>
 #include <TrustWalletCore/TWPublicKeyType.h>
@@ -20,17 +21,76 @@
 #include <TrezorCrypto/bip39.h>
 #include <TrezorCrypto/curves.h>
 
+#include <TrezorCrypto/memzero.h>
+
 #include <array>
+#include <mutex>
 
 using namespace TW;
 
+namespace TW {
+
+struct HDNodeCache {
+    struct Entry {
+        TWCurve curve;
+        std::vector<uint32_t> path;
+        HDNode node;
+    };
+
+    /// Entries are few (one per account in use), so lookups are linear; the cache is simply emptied when full.
+    static constexpr std::size_t capacity = 32;
+
+    std::mutex mutex;
+    std::vector<Entry> entries;
+
+    ~HDNodeCache() { clear(); }
+
+    void clear() {
+        for (auto& entry : entries) {
+            memzero(&entry.node, sizeof(entry.node));
+        }
+        entries.clear();
+    }
+
+    bool find(TWCurve curve, const std::vector<uint32_t>& path, HDNode& node) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& entry : entries) {
+            if (entry.curve == curve && entry.path == path) {
+                node = entry.node;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(TWCurve curve, std::vector<uint32_t> path, const HDNode& node) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& entry : entries) {
+            if (entry.curve == curve && entry.path == path) {
+                return;
+            }
+        }
+        if (entries.size() >= capacity) {
+            clear();
+        }
+        entries.push_back(Entry{curve, std::move(path), node});
+    }
+};
+
+} // namespace TW
+
 namespace {
 
 uint32_t fingerprint(HDNode *node, Hash::Hasher hasher);
 std::string serialize(const HDNode *node, uint32_t fingerprint, uint32_t version, bool use_public, Hash::Hasher hasher);
 bool deserialize(const std::string& extended, TWCurve curve, Hash::Hasher hasher, HDNode *node);
 HDNode getNode(const HDWallet& wallet, TWCurve curve, const DerivationPath& derivationPath);
+HDNode getNode(const HDWallet& wallet, TWCurve curve, const DerivationPath& derivationPath, HDNodeCache* cache);
 HDNode getMasterNode(const HDWallet& wallet, TWCurve curve);
+HDNode getMasterNode(const HDWallet& wallet, TWCurve curve, HDNodeCache* cache);
+std::optional<PublicKey> publicKeyFromNode(const HDNode& node, TWCurve curve, TWPublicKeyType keyType);
+PrivateKey privateKeyFromNode(const HDNode& node, HDWallet::PrivateKeyType privateKeyType);
+int privateChildKeyDerivation(HDNode* node, HDWallet::PrivateKeyType privateKeyType, uint32_t index);
 
 const char* curveName(TWCurve curve);
 } // namespace
@@ -38,7 +98,7 @@ const char* curveName(TWCurve curve);
 const int MnemonicBufLength = Mnemonic::MaxWords * (BIP39_MAX_WORD_LENGTH + 3) + 20; // some extra slack
 
 HDWallet::HDWallet(int strength, const std::string& passphrase)
-    : passphrase(passphrase) {
+    : passphrase(passphrase), nodeCache(std::make_shared<HDNodeCache>()) {
     char buf[MnemonicBufLength];
     const char* mnemonic_chars = mnemonic_generate(strength, buf, MnemonicBufLength);
     if (mnemonic_chars == nullptr) {
@@ -49,7 +109,7 @@ HDWallet::HDWallet(int strength, const std::string& passphrase)
 }
 
 HDWallet::HDWallet(const std::string& mnemonic, const std::string& passphrase, const bool check)
-    : mnemonic(mnemonic), passphrase(passphrase) {
+    : mnemonic(mnemonic), passphrase(passphrase), nodeCache(std::make_shared<HDNodeCache>()) {
     if (check && !Mnemonic::isValid(mnemonic)) {
         throw std::invalid_argument("Invalid mnemonic");
     }
@@ -57,7 +117,7 @@ HDWallet::HDWallet(const std::string& mnemonic, const std::string& passphrase, c
 }
 
 HDWallet::HDWallet(const Data& entropy, const std::string& passphrase)
-    : passphrase(passphrase) {
+    : passphrase(passphrase), nodeCache(std::make_shared<HDNodeCache>()) {
     char buf[MnemonicBufLength];
     const char* mnemonic_chars = mnemonic_from_data(entropy.data(), static_cast<int>(entropy.size()), buf, MnemonicBufLength);
     if (mnemonic_chars == nullptr) {
@@ -89,36 +149,66 @@ void HDWallet::updateSeedAndEntropy() {
 }
 
 PrivateKey HDWallet::getMasterKey(TWCurve curve) const {
-    auto node = getMasterNode(*this, curve);
+    auto node = getMasterNode(*this, curve, nodeCache.get());
     auto data = Data(node.private_key, node.private_key + PrivateKey::size);
     return PrivateKey(data);
 }
 
 PrivateKey HDWallet::getMasterKeyExtension(TWCurve curve) const {
-    auto node = getMasterNode(*this, curve);
+    auto node = getMasterNode(*this, curve, nodeCache.get());
     auto data = Data(node.private_key_extension, node.private_key_extension + PrivateKey::size);
     return PrivateKey(data);
 }
 
 PrivateKey HDWallet::getKey(TWCoinType coin, const DerivationPath& derivationPath) const {
+    const auto curve = TWCoinTypeCurve(coin);
+    auto node = getNode(*this, curve, derivationPath, nodeCache.get());
+    return privateKeyFromNode(node, getPrivateKeyType(curve));
+}
+
+std::vector<PrivateKey> HDWallet::getKeys(TWCoinType coin, const DerivationPath& parent, uint32_t first, uint32_t count, bool hardened) const {
     const auto curve = TWCoinTypeCurve(coin);
     const auto privateKeyType = getPrivateKeyType(curve);
-    auto node = getNode(*this, curve, derivationPath);
-    switch (privateKeyType) {
-        case PrivateKeyTypeExtended96:
-            {
-                auto pkData = Data(node.private_key, node.private_key + PrivateKey::size);
-                auto extData = Data(node.private_key_extension, node.private_key_extension + PrivateKey::size);
-                auto chainCode = Data(node.chain_code, node.chain_code + PrivateKey::size);
-                return PrivateKey(pkData, extData, chainCode);
-            }
+    const uint32_t hardenedIndex = 0x80000000;
+    if (first >= hardenedIndex || count > hardenedIndex - first) {
+        throw std::invalid_argument("Invalid derivation index");
+    }
+    auto node = getNode(*this, curve, parent, nodeCache.get());
+    if (!hardened) {
+        // ed25519, curve25519 and Nano keys only have hardened derivation
+        if (node.curve->params == nullptr && privateKeyType != PrivateKeyTypeExtended96) {
+            throw std::invalid_argument("Non-hardened derivation is not supported on this curve");
+        }
+        // computed once here instead of in every child derivation
+        hdnode_fill_public_key(&node);
+    }
 
-        case PrivateKeyTypeDefault32:
-        default:
-            // default path
-            auto data = Data(node.private_key, node.private_key + PrivateKey::size);
-            return PrivateKey(data);
+    std::vector<PrivateKey> keys;
+    keys.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        auto child = node;
+        if (privateChildKeyDerivation(&child, privateKeyType, DerivationPathIndex(first + i, hardened).derivationIndex()) != 1) {
+            throw std::runtime_error("Private key derivation failed");
+        }
+        keys.push_back(privateKeyFromNode(child, privateKeyType));
     }
+    return keys;
+}
+
+std::vector<PublicKey> HDWallet::getPublicKeys(TWCoinType coin, const DerivationPath& parent, uint32_t first, uint32_t count, bool hardened) const {
+    const auto keys = getKeys(coin, parent, first, count, hardened);
+    const auto publicKeyType = TW::publicKeyType(coin);
+    std::vector<std::optional<PublicKey>> results(keys.size());
+    parallelFor(keys.size(), [&](size_t i) {
+        results[i] = keys[i].getPublicKey(publicKeyType);
+    });
+
+    std::vector<PublicKey> publicKeys;
+    publicKeys.reserve(results.size());
+    for (auto& publicKey : results) {
+        publicKeys.push_back(std::move(*publicKey));
+    }
+    return publicKeys;
 }
 
 std::string HDWallet::deriveAddress(TWCoinType coin) const {
@@ -139,7 +229,7 @@ std::string HDWallet::getExtendedPrivateKey(TWPurpose purpose, TWCoinType coin,
     return serialize(&node, fingerprintValue, version, false, base58Hasher(coin));
 }
 
-std::string HDWallet::getExtendedPublicKey(TWPurpose purpose, TWCoinType coin, TWHDVersion version) const {
+std::string HDWallet::getExtendedPublicKey(TWPurpose purpose, TWCoinType coin, TWHDVersion version, uint32_t account) const {
     if (version == TWHDVersionNone) {
         return "";
     }
@@ -148,7 +238,7 @@ std::string HDWallet::getExtendedPublicKey(TWPurpose purpose, TWCoinType coin, T
     auto derivationPath = TW::DerivationPath({DerivationPathIndex(purpose, true), DerivationPathIndex(coin, true)});
     auto node = getNode(*this, curve, derivationPath);
     auto fingerprintValue = fingerprint(&node, publicKeyHasher(coin));
-    hdnode_private_ckd(&node, 0x80000000);
+    hdnode_private_ckd(&node, DerivationPathIndex(account, true).derivationIndex());
     hdnode_fill_public_key(&node);
     return serialize(&node, fingerprintValue, version, true, base58Hasher(coin));
 }
@@ -167,26 +257,50 @@ std::optional<PublicKey> HDWallet::getPublicKeyFromExtended(const std::string& e
     hdnode_public_ckd(&node, path.change());
     hdnode_public_ckd(&node, path.address());
     hdnode_fill_public_key(&node);
+    return publicKeyFromNode(node, curve, TW::publicKeyType(coin));
+}
 
-    // These public key type are not applicable.  Handled above, as node.curve->params is null
-    assert(curve != TWCurveED25519 && curve != TWCurveED25519Blake2bNano && curve != TWCurveED25519Extended && curve != TWCurveCurve25519);
-    TWPublicKeyType keyType = TW::publicKeyType(coin);
-    if (curve == TWCurveSECP256k1) {
-        auto pubkey = PublicKey(Data(node.public_key, node.public_key + 33), TWPublicKeyTypeSECP256k1);
-        if (keyType == TWPublicKeyTypeSECP256k1Extended) {
-            return pubkey.extended();
-        } else {
-            return pubkey;
+std::vector<PublicKey> HDWallet::getPublicKeysFromExtended(const std::string& extended, TWCoinType coin, uint32_t change, uint32_t first, uint32_t count) {
+    // public derivation is only defined for non-hardened indices
+    const uint32_t hardenedIndex = 0x80000000;
+    if (change >= hardenedIndex || first >= hardenedIndex || count > hardenedIndex - first) {
+        throw std::invalid_argument("Invalid derivation index");
+    }
+
+    const auto curve = TW::curve(coin);
+    const auto hasher = TW::base58Hasher(coin);
+    const auto keyType = TW::publicKeyType(coin);
+
+    auto node = HDNode{};
+    if (!deserialize(extended, curve, hasher, &node)) {
+        return {};
+    }
+    if (node.curve->params == nullptr) {
+        return {};
+    }
+    if (hdnode_public_ckd(&node, change) != 1) {
+        throw std::runtime_error("Public key derivation failed");
+    }
+
+    std::vector<std::optional<PublicKey>> keys(count);
+    parallelFor(count, [&](size_t i) {
+        auto child = node;
+        if (hdnode_public_ckd(&child, first + static_cast<uint32_t>(i)) != 1) {
+            throw std::runtime_error("Public key derivation failed");
         }
-    } else if (curve == TWCurveNIST256p1) {
-        auto pubkey = PublicKey(Data(node.public_key, node.public_key + 33), TWPublicKeyTypeNIST256p1);
-        if (keyType == TWPublicKeyTypeNIST256p1Extended) {
-            return pubkey.extended();
-        } else {
-            return pubkey;
+        hdnode_fill_public_key(&child);
+        keys[i] = publicKeyFromNode(child, curve, keyType);
+    });
+
+    std::vector<PublicKey> result;
+    result.reserve(count);
+    for (auto& key : keys) {
+        if (!key.has_value()) {
+            return {};
         }
+        result.push_back(std::move(*key));
     }
-    return {};
+    return result;
 }
 
 std::optional<PrivateKey> HDWallet::getPrivateKeyFromExtended(const std::string& extended, TWCoinType coin, const DerivationPath& path) {
@@ -222,6 +336,27 @@ uint32_t fingerprint(HDNode *node, Hash::Hasher hasher) {
     return ((uint32_t) digest[0] << 24) + (digest[1] << 16) + (digest[2] << 8) + digest[3];
 }
 
+std::optional<PublicKey> publicKeyFromNode(const HDNode& node, TWCurve curve, TWPublicKeyType keyType) {
+    // These public key type are not applicable.  Handled by the callers, as node.curve->params is null
+    assert(curve != TWCurveED25519 && curve != TWCurveED25519Blake2bNano && curve != TWCurveED25519Extended && curve != TWCurveCurve25519);
+    if (curve == TWCurveSECP256k1) {
+        auto pubkey = PublicKey(Data(node.public_key, node.public_key + 33), TWPublicKeyTypeSECP256k1);
+        if (keyType == TWPublicKeyTypeSECP256k1Extended) {
+            return pubkey.extended();
+        } else {
+            return pubkey;
+        }
+    } else if (curve == TWCurveNIST256p1) {
+        auto pubkey = PublicKey(Data(node.public_key, node.public_key + 33), TWPublicKeyTypeNIST256p1);
+        if (keyType == TWPublicKeyTypeNIST256p1Extended) {
+            return pubkey.extended();
+        } else {
+            return pubkey;
+        }
+    }
+    return {};
+}
+
 std::string serialize(const HDNode *node, uint32_t fingerprint, uint32_t version, bool use_public, Hash::Hasher hasher) {
     Data node_data;
     node_data.reserve(78);
@@ -272,20 +407,90 @@ bool deserialize(const std::string& extended, TWCurve curve, Hash::Hasher hasher
     return true;
 }
 
+int privateChildKeyDerivation(HDNode* node, HDWallet::PrivateKeyType privateKeyType, uint32_t index) {
+    switch (privateKeyType) {
+        case HDWallet::PrivateKeyTypeExtended96:
+            // special handling for extended
+            return hdnode_private_ckd_cardano(node, index);
+        case HDWallet::PrivateKeyTypeDefault32:
+        default:
+            return hdnode_private_ckd(node, index);
+    }
+}
+
+PrivateKey privateKeyFromNode(const HDNode& node, HDWallet::PrivateKeyType privateKeyType) {
+    switch (privateKeyType) {
+        case HDWallet::PrivateKeyTypeExtended96:
+            {
+                auto pkData = Data(node.private_key, node.private_key + PrivateKey::size);
+                auto extData = Data(node.private_key_extension, node.private_key_extension + PrivateKey::size);
+                auto chainCode = Data(node.chain_code, node.chain_code + PrivateKey::size);
+                return PrivateKey(pkData, extData, chainCode);
+            }
+
+        case HDWallet::PrivateKeyTypeDefault32:
+        default:
+            // default path
+            auto data = Data(node.private_key, node.private_key + PrivateKey::size);
+            return PrivateKey(data);
+    }
+}
+
+/// Whether the curve only has hardened derivation, or in Cardano's case costly soft steps, so that caching derived
+/// nodes pays off.
+bool cachesNodes(TWCurve curve) {
+    switch (curve) {
+    case TWCurveED25519:
+    case TWCurveED25519Blake2bNano:
+    case TWCurveED25519Extended:
+    case TWCurveCurve25519:
+        return true;
+    default:
+        return false;
+    }
+}
+
+HDNode getNode(const HDWallet& wallet, TWCurve curve, const DerivationPath& derivationPath, HDNodeCache* cache) {
+    if (cache == nullptr || !cachesNodes(curve) || derivationPath.indices.empty()) {
+        return getNode(wallet, curve, derivationPath);
+    }
+
+    std::vector<uint32_t> parentPath;
+    parentPath.reserve(derivationPath.indices.size() - 1);
+    for (std::size_t i = 0; i + 1 < derivationPath.indices.size(); ++i) {
+        parentPath.push_back(derivationPath.indices[i].derivationIndex());
+    }
+
+    auto node = HDNode();
+    if (!cache->find(curve, parentPath, node)) {
+        node = getMasterNode(wallet, curve, cache);
+        for (auto index : parentPath) {
+            privateChildKeyDerivation(&node, HDWallet::getPrivateKeyType(curve), index);
+        }
+        cache->insert(curve, std::move(parentPath), node);
+    }
+    privateChildKeyDerivation(&node, HDWallet::getPrivateKeyType(curve), derivationPath.indices.back().derivationIndex());
+    return node;
+}
+
 HDNode getNode(const HDWallet& wallet, TWCurve curve, const DerivationPath& derivationPath) {
     const auto privateKeyType = HDWallet::getPrivateKeyType(curve);
     auto node = getMasterNode(wallet, curve);
     for (auto& index : derivationPath.indices) {
-        switch (privateKeyType) {
-            case HDWallet::PrivateKeyTypeExtended96:
-                // special handling for extended
-                hdnode_private_ckd_cardano(&node, index.derivationIndex());
-                break;
-            case HDWallet::PrivateKeyTypeDefault32:
-            default:
-                hdnode_private_ckd(&node, index.derivationIndex());
-                break;
-        }
+        privateChildKeyDerivation(&node, privateKeyType, index.derivationIndex());
+    }
+    return node;
+}
+
+HDNode getMasterNode(const HDWallet& wallet, TWCurve curve, HDNodeCache* cache) {
+    // only the Cardano root is worth caching, it is stretched from the entropy with PBKDF2
+    if (cache == nullptr || HDWallet::getPrivateKeyType(curve) != HDWallet::PrivateKeyTypeExtended96) {
+        return getMasterNode(wallet, curve);
+    }
+    auto node = HDNode();
+    if (!cache->find(curve, {}, node)) {
+        node = getMasterNode(wallet, curve);
+        cache->insert(curve, {}, node);
     }
     return node;
 }
@@ -18,11 +18,16 @@
 #include <TrustWalletCore/TWPurpose.h>
 
 #include <array>
+#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace TW {
 
+/// Intermediate derivation nodes kept by an HDWallet, see HDWallet::getKey.
+struct HDNodeCache;
+
 class HDWallet {
   public:
     static constexpr size_t seedSize = 64;
@@ -42,6 +47,9 @@ class HDWallet {
     /// Entropy is the binary 1-to-1 representation of the mnemonic (11 bits from each word)
     TW::Data entropy;
 
+    /// Cached intermediate nodes, shared by copies of the wallet and wiped when the last copy is destroyed.
+    std::shared_ptr<HDNodeCache> nodeCache;
+
   public:
     const std::array<byte, seedSize>& getSeed() const { return seed; }
     const std::string& getMnemonic() const { return mnemonic; }
@@ -75,20 +83,37 @@ class HDWallet {
     PrivateKey getMasterKeyExtension(TWCurve curve) const;
 
     /// Returns the private key at the given derivation path.
+    /// On ed25519 curves, where every level is hardened, the parent node of the path (the account node for most
+    /// coins) is cached, so keys sharing it only pay for the last derivation step. The Cardano root is cached too.
     PrivateKey getKey(const TWCoinType coin, const DerivationPath& derivationPath) const;
 
+    /// Returns the private keys at parent/first ... parent/(first + count - 1), deriving the parent path only once.
+    /// @throws std::invalid_argument if the indices reach 2^31, or if non-hardened keys are requested on a curve that
+    /// only derives hardened children (ed25519, curve25519); std::runtime_error if a derivation step fails.
+    std::vector<PrivateKey> getKeys(TWCoinType coin, const DerivationPath& parent, uint32_t first, uint32_t count, bool hardened) const;
+
+    /// Returns the public keys of the coin's type at parent/first ... parent/(first + count - 1), computed in parallel.
+    /// @throws the same exceptions as getKeys.
+    std::vector<PublicKey> getPublicKeys(TWCoinType coin, const DerivationPath& parent, uint32_t first, uint32_t count, bool hardened) const;
+
     /// Derives the address for a coin.
     std::string deriveAddress(TWCoinType coin) const;
 
     /// Returns the extended private key.
     std::string getExtendedPrivateKey(TWPurpose purpose, TWCoinType coin, TWHDVersion version) const;
 
-    /// Returns the extended public key.
-    std::string getExtendedPublicKey(TWPurpose purpose, TWCoinType coin, TWHDVersion version) const;
+    /// Returns the extended public key of the given account.
+    std::string getExtendedPublicKey(TWPurpose purpose, TWCoinType coin, TWHDVersion version, uint32_t account = 0) const;
 
     /// Computes the public key from an extended public key representation.
     static std::optional<PublicKey> getPublicKeyFromExtended(const std::string& extended, TWCoinType coin, const DerivationPath& path);
 
+    /// Computes the public keys at change/first ... change/(first + count - 1) below an extended public key,
+    /// parsing it and deriving the change level only once.  Returns an empty list if the key is invalid.
+    /// Throws std::invalid_argument if change or any address index is hardened (2^31 or more), and
+    /// std::runtime_error if a derivation step fails.
+    static std::vector<PublicKey> getPublicKeysFromExtended(const std::string& extended, TWCoinType coin, uint32_t change, uint32_t first, uint32_t count);
+
     /// Computes the private key from an extended private key representation.
     static std::optional<PrivateKey> getPrivateKeyFromExtended(const std::string& extended, TWCoinType coin, const DerivationPath& path);
 
@@ -8,54 +8,74 @@
 
 #include "../Base64.h"
 #include "../Hash.h"
-#include "../HexCoding.h"
 #include "../PrivateKey.h"
-#include "../uint256.h"
 
-#include <boost/multiprecision/cpp_int.hpp>
 #include <nlohmann/json.hpp>
 
-#include <algorithm>
-#include <iostream>
-#include <sstream>
+#include <charconv>
+#include <iterator>
 
 using namespace TW;
 using namespace TW::Icon;
 
-std::string to_hex(int64_t i) {
-    std::stringstream ss;
-    ss << "0x" << std::hex << i;
-    return ss.str();
+namespace {
+
+/// Appends `0x` and the lowercase hex digits of `value`, as two's complement for negative values.
+void appendHex(std::string& out, int64_t value) {
+    char buffer[2 + 16] = {'0', 'x'};
+    const auto result = std::to_chars(buffer + 2, std::end(buffer), static_cast<uint64_t>(value), 16);
+    out.append(buffer, result.ptr);
 }
 
-std::string to_hex(const std::string& n) {
-    auto s = hex(n);
-    auto start = std::find_if(s.begin(), s.end(), [](auto c) { return c != '0'; });
-    if (start == s.end()) {
-        return "0x0";
+/// Appends `0x` and the big-endian number `bytes` in lowercase hex without leading zeros, `0x0` for zero.
+void appendHex(std::string& out, const std::string& bytes) {
+    static constexpr char digits[] = "0123456789abcdef";
+    out += "0x";
+    const auto size = out.size();
+    for (const auto c : bytes) {
+        const auto b = static_cast<uint8_t>(c);
+        if (out.size() > size || b >= 0x10) {
+            out += digits[b >> 4];
+        }
+        if (out.size() > size || b != 0) {
+            out += digits[b & 0x0f];
+        }
+    }
+    if (out.size() == size) {
+        out += '0';
     }
-    return "0x" + std::string(start, s.end());
 }
 
-std::map<std::string, std::string> Signer::parameters() const noexcept {
-    auto params = std::map<std::string, std::string>();
-    params["from"] = input.from_address();
-    params["to"] = input.to_address();
-    params["timestamp"] = to_hex(input.timestamp());
-    params["nonce"] = to_hex(input.nonce());
-    params["stepLimit"] = to_hex(input.step_limit());
-    params["value"] = to_hex(input.value());
-    params["nid"] = to_hex(input.network_id());
-    params["version"] = "0x3";
-    return params;
+template <typename T>
+std::string to_hex(const T& value) {
+    std::string result;
+    appendHex(result, value);
+    return result;
 }
 
+} // namespace
+
 std::string Signer::preImage() const noexcept {
-    std::string txHash = "icx_sendTransaction";
-    const auto params = parameters();
-    for (auto [key, value] : params) {
-        txHash += "." + key + "." + value;
-    }
+    // "icx_sendTransaction" followed by ".key.value" for every parameter, keys in lexicographic order
+    std::string txHash;
+    txHash.reserve(160 + input.from_address().size() + input.to_address().size() +
+                   2 * (input.nonce().size() + input.step_limit().size() + input.value().size() +
+                        input.network_id().size()));
+    txHash += "icx_sendTransaction.from.";
+    txHash += input.from_address();
+    txHash += ".nid.";
+    appendHex(txHash, input.network_id());
+    txHash += ".nonce.";
+    appendHex(txHash, input.nonce());
+    txHash += ".stepLimit.";
+    appendHex(txHash, input.step_limit());
+    txHash += ".timestamp.";
+    appendHex(txHash, input.timestamp());
+    txHash += ".to.";
+    txHash += input.to_address();
+    txHash += ".value.";
+    appendHex(txHash, input.value());
+    txHash += ".version.0x3";
     return txHash;
 }
 
@@ -85,10 +105,13 @@ Proto::SigningOutput Signer::sign() const noexcept {
     const auto signature = key.sign(hash, TWCurveSECP256k1);
 
     auto output = Proto::SigningOutput();
-    output.set_signature(signature.data(), signature.size());
-
-    auto encoded = encode(Data(signature.begin(), signature.end()));
-    output.set_encoded(encoded.data(), encoded.size());
+    if (input.output_format() != Common::Proto::Output_json) {
+        output.set_signature(signature.data(), signature.size());
+    }
+    if (input.output_format() != Common::Proto::Output_raw) {
+        auto encoded = encode(Data(signature.begin(), signature.end()));
+        output.set_encoded(encoded.data(), encoded.size());
+    }
 
     return output;
 }
@@ -0,0 +1,130 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "AccountDiscovery.h"
+
+#include "../Coin.h"
+#include "../Parallel.h"
+
+#include <algorithm>
+
+using namespace TW;
+using namespace TW::Keystore;
+
+namespace {
+
+/// A chain of addresses of one coin account: parent/0, parent/1, ...; or a single address when single is set.
+struct Chain {
+    std::size_t coin;
+    DerivationPath parent;
+    bool hardened = false;
+    bool single = false;
+    std::vector<Account> found;
+};
+
+/// Appends the chains of the given account of a coin.
+void addChains(std::vector<Chain>& chains, std::size_t coinIndex, TWCoinType coin, uint32_t account) {
+    auto path = TW::derivationPath(coin);
+    path.setAccount(account);
+    if (path.indices.size() != 5) {
+        chains.push_back(Chain{coinIndex, path, false, true, {}});
+        return;
+    }
+
+    const auto hardened = path.indices[4].hardened;
+    path.indices.pop_back();
+    if (path.indices[3].hardened) {
+        chains.push_back(Chain{coinIndex, path, hardened, false, {}});
+        return;
+    }
+    for (uint32_t change : {0, 1}) {
+        path.setChange(change);
+        chains.push_back(Chain{coinIndex, path, hardened, false, {}});
+    }
+}
+
+void scan(const HDWallet& wallet, TWCoinType coin, std::size_t gapLimit, const AccountDiscovery::IsUsed& isUsed, Chain& chain) {
+    if (chain.single) {
+        auto address = TW::deriveAddress(coin, wallet.getKey(coin, chain.parent));
+        if (isUsed(coin, address)) {
+            chain.found.emplace_back(std::move(address), coin, chain.parent);
+        }
+        return;
+    }
+
+    // every batch is just large enough to close the gap if none of its addresses is used
+    uint32_t next = 0;
+    std::size_t gap = 0;
+    while (gap < gapLimit && next < 0x80000000) {
+        const auto count = static_cast<uint32_t>(std::min<std::size_t>(gapLimit - gap, 0x80000000 - next));
+        const auto keys = wallet.getKeys(coin, chain.parent, next, count, chain.hardened);
+        for (uint32_t i = 0; i < count; ++i) {
+            auto address = TW::deriveAddress(coin, keys[i]);
+            if (!isUsed(coin, address)) {
+                ++gap;
+                continue;
+            }
+            gap = 0;
+            auto path = chain.parent;
+            path.indices.emplace_back(next + i, chain.hardened);
+            chain.found.emplace_back(std::move(address), coin, std::move(path));
+        }
+        next += count;
+    }
+}
+
+} // namespace
+
+std::vector<Account> AccountDiscovery::discover(const HDWallet& wallet, const std::vector<TWCoinType>& coins, const IsUsed& isUsed) const {
+    const auto gap = std::max<std::size_t>(1, gapLimit);
+    std::vector<std::vector<Account>> found(coins.size());
+    std::vector<std::size_t> active(coins.size());
+    for (std::size_t i = 0; i < coins.size(); ++i) {
+        active[i] = i;
+    }
+
+    std::vector<Chain> chains;
+    for (uint32_t account = 0; account < maxAccounts && !active.empty(); ++account) {
+        chains.clear();
+        for (auto coinIndex : active) {
+            addChains(chains, coinIndex, coins[coinIndex], account);
+        }
+        parallelFor(chains.size(), [&](std::size_t i) {
+            scan(wallet, coins[chains[i].coin], gap, isUsed, chains[i]);
+        });
+
+        // chains are grouped by coin, in the order of active
+        std::vector<std::size_t> used;
+        std::vector<std::size_t> firstAccount;
+        for (const auto& chain : chains) {
+            if (chain.found.empty()) {
+                continue;
+            }
+            if (used.empty() || used.back() != chain.coin) {
+                used.push_back(chain.coin);
+                firstAccount.push_back(found[chain.coin].size());
+            }
+            auto& accounts = found[chain.coin];
+            accounts.insert(accounts.end(), std::make_move_iterator(chain.found.begin()), std::make_move_iterator(chain.found.end()));
+        }
+
+        parallelFor(used.size(), [&](std::size_t i) {
+            const auto coin = coins[used[i]];
+            auto& accounts = found[used[i]];
+            const auto extendedPublicKey = wallet.getExtendedPublicKey(TW::purpose(coin), coin, TW::xpubVersion(coin), account);
+            for (auto a = firstAccount[i]; a < accounts.size(); ++a) {
+                accounts[a].extendedPublicKey = extendedPublicKey;
+            }
+        });
+        active = std::move(used);
+    }
+
+    std::vector<Account> result;
+    for (auto& accounts : found) {
+        result.insert(result.end(), std::make_move_iterator(accounts.begin()), std::make_move_iterator(accounts.end()));
+    }
+    return result;
+}
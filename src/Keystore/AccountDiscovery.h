@@ -0,0 +1,51 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Account.h"
+#include "../HDWallet.h"
+
+#include <TrustWalletCore/TWCoinType.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace TW::Keystore {
+
+/// Discovers the used accounts and addresses of a wallet, BIP44 style, e.g. when restoring it from its mnemonic.
+///
+/// Accounts are scanned in order, starting at 0, each coin's derivation path template giving the path shape:
+/// - m/purpose'/coin'/account'/change/address: the receive and change chains are walked until gapLimit
+///   consecutive unused addresses are found;
+/// - the same with a hardened change level: only the template's chain is walked;
+/// - shorter paths, such as m/44'/148'/account': the account has a single address.
+/// A coin stops at its first account without any used address. In every account round the chains of all coins are
+/// scanned in parallel, each chain deriving its node once and its addresses a batch at a time.
+class AccountDiscovery {
+public:
+    /// Whether an address has been used on chain. Called concurrently from several threads.
+    using IsUsed = std::function<bool(TWCoinType coin, const std::string& address)>;
+
+    /// Number of consecutive unused addresses after which a chain is considered exhausted.
+    std::size_t gapLimit = 20;
+
+    /// Upper bound on the number of accounts scanned per coin.
+    uint32_t maxAccounts = 100;
+
+    AccountDiscovery() = default;
+    explicit AccountDiscovery(std::size_t gapLimit) : gapLimit(gapLimit) {}
+
+    /// Returns one account per used address, grouped by coin in the given order, then ordered by account, chain and
+    /// address index. Accounts carry their full derivation path and the extended public key of their BIP44 account,
+    /// ready for StoredKey::addAccount. Exceptions thrown by isUsed are propagated.
+    std::vector<Account> discover(const HDWallet& wallet, const std::vector<TWCoinType>& coins, const IsUsed& isUsed) const;
+};
+
+} // namespace TW::Keystore
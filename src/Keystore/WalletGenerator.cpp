@@ -0,0 +1,70 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "WalletGenerator.h"
+
+#include "../HDWallet.h"
+#include "../Parallel.h"
+
+#include <TrezorCrypto/memzero.h>
+#include <TrezorCrypto/rand.h>
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+
+using namespace TW;
+using namespace TW::Keystore;
+
+void WalletGenerator::generate(std::size_t count, const std::string& name, const Data& password, const Sink& sink) const {
+    if (strength < 128 || strength > 256 || strength % 32 != 0) {
+        throw std::invalid_argument("Invalid strength");
+    }
+    const std::size_t entropySize = strength / 8;
+    const std::size_t chunk = std::max<std::size_t>(1, chunkSize);
+
+    Data entropy;
+    std::vector<std::optional<StoredKey>> keys;
+    for (std::size_t start = 0; start < count; start += chunk) {
+        const auto size = std::min(chunk, count - start);
+
+        // entropy for the whole chunk is drawn at once, then sliced per wallet
+        entropy.resize(size * entropySize);
+        random_buffer(entropy.data(), entropy.size());
+
+        keys.assign(size, std::nullopt);
+        try {
+            parallelFor(size, [&](std::size_t i) {
+                Data walletEntropy(entropy.begin() + i * entropySize, entropy.begin() + (i + 1) * entropySize);
+                try {
+                    keys[i] = generateOne(walletEntropy, name + std::to_string(start + i), password);
+                } catch (...) {
+                    memzero(walletEntropy.data(), walletEntropy.size());
+                    throw;
+                }
+                memzero(walletEntropy.data(), walletEntropy.size());
+            });
+        } catch (...) {
+            memzero(entropy.data(), entropy.size());
+            throw;
+        }
+        memzero(entropy.data(), entropy.size());
+
+        for (std::size_t i = 0; i < size; ++i) {
+            sink(start + i, std::move(*keys[i]));
+        }
+        keys.clear();
+    }
+}
+
+StoredKey WalletGenerator::generateOne(const Data& entropy, const std::string& name, const Data& password) const {
+    const auto wallet = HDWallet(entropy, "");
+    auto key = StoredKey::createWithMnemonic(name, password, wallet.getMnemonic());
+    for (auto coin : coins) {
+        key.account(coin, &wallet);
+    }
+    return key;
+}
@@ -0,0 +1,52 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "StoredKey.h"
+#include "../Data.h"
+
+#include <TrustWalletCore/TWCoinType.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace TW::Keystore {
+
+/// Generates fresh random mnemonic wallets in bulk, e.g. for provisioning.
+///
+/// Wallets are generated a chunk at a time, the wallets of a chunk in parallel,
+/// and every finished StoredKey is handed to the sink before the next chunk starts,
+/// so at most chunkSize wallets are held in memory.
+class WalletGenerator {
+public:
+    /// Receives each generated key, in index order, on the calling thread.
+    using Sink = std::function<void(std::size_t index, StoredKey&& key)>;
+
+    /// Mnemonic strength in bits: 128, 160, 192, 224 or 256.
+    int strength = 128;
+
+    /// Coins whose default account (address and extended public key) is added to every key.
+    std::vector<TWCoinType> coins;
+
+    /// Number of wallets generated between two rounds of sink calls.
+    std::size_t chunkSize = 64;
+
+    WalletGenerator() = default;
+    WalletGenerator(int strength, std::vector<TWCoinType> coins) : strength(strength), coins(std::move(coins)) {}
+
+    /// Generates count wallets, named name followed by their index, with mnemonics encrypted by password.
+    /// @throws std::invalid_argument if the strength is invalid; exceptions thrown by the sink are propagated.
+    void generate(std::size_t count, const std::string& name, const Data& password, const Sink& sink) const;
+
+    /// Generates a single wallet from the given entropy, with the default accounts for coins.
+    /// @throws std::invalid_argument if the entropy size is not a valid mnemonic strength.
+    StoredKey generateOne(const Data& entropy, const std::string& name, const Data& password) const;
+};
+
+} // namespace TW::Keystore
@@ -6,83 +6,142 @@
 
 #include "Serialization.h"
 
-#include "../BinaryCoding.h"
 #include "../PrivateKey.h"
+#include "../VarInt.h"
+
+#include <algorithm>
+#include <cstring>
 
 using namespace TW;
 using namespace TW::NEAR;
 using namespace TW::NEAR::Proto;
 
+namespace {
 
-static void writeU8(Data& data, uint8_t number) {
-    data.push_back(number);
-}
+/// Counts the bytes a Borsh serialization takes, so the output can be allocated once.
+class SizeCounter {
+  public:
+    std::size_t size = 0;
 
-static void writeU32(Data& data, uint32_t number) {
-    encode32LE(number, data);
-}
+    void writeU8(uint8_t) { size += 1; }
+    void writeU32(uint32_t) { size += 4; }
+    void writeU64(uint64_t) { size += 8; }
+    void writeU128(const std::string&) { size += 16; }
+    void writeRaw(const void*, std::size_t length) { size += length; }
+};
 
-static void writeU64(Data& data, uint64_t number) {
-    encode64LE(number, data);
-}
+/// Writes Borsh into a buffer sized by SizeCounter.
+class BufferWriter {
+  public:
+    explicit BufferWriter(byte* out) : out(out) {}
 
-static void writeU128(Data& data, const std::string& numberData) {
-    data.insert(std::end(data), std::begin(numberData), std::end(numberData));
-}
+    void writeU8(uint8_t number) { *out++ = number; }
 
-template <class T> static void writeRawBuffer(Data& data, const T& buf) {
-    data.insert(std::end(data), std::begin(buf), std::end(buf));
-}
+    void writeU32(uint32_t number) {
+        VarInt::writeLE(number, 4, out);
+        out += 4;
+    }
 
-static void writeString(Data& data, const std::string& str) {
-    writeU32(data, static_cast<uint32_t>(str.length()));
-    writeRawBuffer(data, str);
-}
+    void writeU64(uint64_t number) {
+        VarInt::writeLE(number, 8, out);
+        out += 8;
+    }
 
-static void writePublicKey(Data& data, const Proto::PublicKey& publicKey) {
-    writeU8(data, static_cast<uint8_t>(publicKey.key_type()));
-    const auto& keyData = publicKey.data();
-    writeRawBuffer(data, keyData);
+    /// Little-endian bytes, zero-padded or truncated to 16.
+    void writeU128(const std::string& numberData) {
+        const auto length = std::min<std::size_t>(numberData.size(), 16);
+        std::memcpy(out, numberData.data(), length);
+        std::memset(out + length, 0, 16 - length);
+        out += 16;
+    }
+
+    void writeRaw(const void* data, std::size_t length) {
+        if (length != 0) {
+            std::memcpy(out, data, length);
+            out += length;
+        }
+    }
+
+  private:
+    byte* out;
+};
+
+template <typename Writer>
+void writeString(Writer& writer, const std::string& str) {
+    writer.writeU32(static_cast<uint32_t>(str.length()));
+    writer.writeRaw(str.data(), str.size());
 }
 
-static void writeTransfer(Data& data, const Proto::Transfer& transfer) {
-    writeU128(data, transfer.deposit());
+template <typename Writer>
+void writeFunctionCall(Writer& writer, const Proto::FunctionCall& functionCall) {
+    writeString(writer, functionCall.method_name());
+    writeString(writer, functionCall.args());
+    writer.writeU64(functionCall.gas());
+    writer.writeU128(functionCall.deposit());
 }
 
-static void writeAction(Data& data, const Proto::Action& action) {
-    writeU8(data, action.payload_case() - Proto::Action::kCreateAccount);
+template <typename Writer>
+void writeAction(Writer& writer, const Proto::Action& action) {
+    writer.writeU8(static_cast<uint8_t>(action.payload_case() - Proto::Action::kCreateAccount));
     switch (action.payload_case()) {
-        case Proto::Action::kTransfer:
-            writeTransfer(data, action.transfer());
-            return;
-        default:
-            return;
+    case Proto::Action::kDeployContract:
+        writeString(writer, action.deploy_contract().code());
+        return;
+    case Proto::Action::kFunctionCall:
+        writeFunctionCall(writer, action.function_call());
+        return;
+    case Proto::Action::kTransfer:
+        writer.writeU128(action.transfer().deposit());
+        return;
+    case Proto::Action::kDeleteAccount:
+        writeString(writer, action.delete_account().beneficiary_id());
+        return;
+    default:
+        return;
     }
 }
 
-Data TW::NEAR::transactionData(const Proto::SigningInput& input) {
-    Data data;
-    writeString(data, input.signer_id());
-    auto key = PrivateKey(input.private_key());
-    auto public_key = key.getPublicKey(TWPublicKeyTypeED25519);
-    auto public_key_proto = Proto::PublicKey();
-    public_key_proto.set_data(public_key.bytes.data(), public_key.bytes.size());
-    writePublicKey(data, public_key_proto);
-    writeU64(data, input.nonce());
-    writeString(data, input.receiver_id());
-    const auto& block_hash = input.block_hash();
-    writeRawBuffer(data, block_hash);
-    writeU32(data, input.actions_size());
+template <typename Writer>
+void writeTransaction(Writer& writer, const Proto::SigningInput& input, const TW::PublicKey& publicKey) {
+    writeString(writer, input.signer_id());
+    // key type 0 is ed25519
+    writer.writeU8(0);
+    writer.writeRaw(publicKey.bytes.data(), publicKey.bytes.size());
+    writer.writeU64(input.nonce());
+    writeString(writer, input.receiver_id());
+    writer.writeRaw(input.block_hash().data(), input.block_hash().size());
+    writer.writeU32(static_cast<uint32_t>(input.actions_size()));
     for (const auto& action : input.actions()) {
-        writeAction(data, action);
+        writeAction(writer, action);
     }
+}
+
+} // namespace
+
+Data TW::NEAR::transactionData(const Proto::SigningInput& input, std::size_t reserve) {
+    const auto publicKey = PrivateKey(input.private_key()).getPublicKey(TWPublicKeyTypeED25519);
+
+    SizeCounter counter;
+    writeTransaction(counter, input, publicKey);
+
+    Data data;
+    data.reserve(counter.size + reserve);
+    data.resize(counter.size);
+    BufferWriter writer(data.data());
+    writeTransaction(writer, input, publicKey);
     return data;
 }
 
+void TW::NEAR::appendSignature(Data& transactionData, const Data& signatureData) {
+    // signature type 0 is ed25519
+    transactionData.push_back(0);
+    append(transactionData, signatureData);
+}
+
 Data TW::NEAR::signedTransactionData(const Data& transactionData, const Data& signatureData) {
     Data data;
-    writeRawBuffer(data, transactionData);
-    writeU8(data, 0);
-    writeRawBuffer(data, signatureData);
+    data.reserve(transactionData.size() + 1 + signatureData.size());
+    append(data, transactionData);
+    appendSignature(data, signatureData);
     return data;
 }
@@ -9,9 +9,17 @@
 #include "../proto/NEAR.pb.h"
 #include "../Data.h"
 
+#include <cstddef>
+
 namespace TW::NEAR {
 
-Data transactionData(const Proto::SigningInput& input);
+/// Borsh-serialized transaction with all its actions, to one receiver.
+/// `reserve` bytes of extra capacity let the signature be appended without reallocating.
+Data transactionData(const Proto::SigningInput& input, std::size_t reserve = 0);
+
+/// Appends the ed25519 signature, turning a serialized transaction into a signed one.
+void appendSignature(Data& transactionData, const Data& signatureData);
+
 Data signedTransactionData(const Data& transactionData, const Data& signatureData);
 
 } // namespace
@@ -14,12 +14,13 @@ using namespace TW;
 using namespace TW::NEAR;
 
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
-    auto transaction = transactionData(input);
+    // signature type byte and ed25519 signature
+    auto transaction = transactionData(input, 1 + 64);
     auto key = PrivateKey(input.private_key());
     auto hash = Hash::sha256(transaction);
     auto signature = key.sign(hash, TWCurveED25519);
+    appendSignature(transaction, signature);
     auto output = Proto::SigningOutput();
-    auto signedTransaction = signedTransactionData(transaction, signature);
-    output.set_signed_transaction(signedTransaction.data(), signedTransaction.size());
+    output.set_signed_transaction(transaction.data(), transaction.size());
     return output;
 }
@@ -5,6 +5,7 @@
 // file LICENSE at the root of the source code distribution tree.
 
 #include "../Data.h"
+#include "../VarInt.h"
 #include "ReadData.h"
 
 
@@ -25,16 +26,10 @@ TW::Data TW::readVarBytes(const Data& from, int initial_pos, uint32_t* dataRead)
 }
 
 template<> uint64_t TW::readVar(const TW::Data& from, int initial_pos, const uint64_t &max) {
-    byte fb = from[initial_pos];
-    uint64_t value;
-    if (fb == 0xFD) {
-        value = decode16LE(from.data() + initial_pos + 1);
-    } else if (fb == 0xFE) {
-        value = decode32LE(from.data() + initial_pos + 1);
-    } else if (fb == 0xFF) {
-        value = decode64LE(from.data() + initial_pos + 1);
-    } else {
-        value = fb;
+    size_t index = initial_pos;
+    uint64_t value = 0;
+    if (!VarInt::readCompactSize(from.data(), from.size(), index, value)) {
+        throw std::invalid_argument("ReadData::ReadVarInt error: Not enough data");
     }
     if (value > max) {
         // std::cout << "TOO HUGE VALUE: " << value << " max=" << max << std::endl;
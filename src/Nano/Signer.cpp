@@ -158,8 +158,13 @@ std::array<byte, 64> Signer::sign() const noexcept {
 Proto::SigningOutput Signer::build() const {
     auto output = Proto::SigningOutput();
     const auto signature = sign();
-    output.set_signature(signature.data(), signature.size());
-    output.set_block_hash(blockHash.data(), blockHash.size());
+    if (input.output_format() != Common::Proto::Output_json) {
+        output.set_signature(signature.data(), signature.size());
+        output.set_block_hash(blockHash.data(), blockHash.size());
+    }
+    if (input.output_format() == Common::Proto::Output_raw) {
+        return output;
+    }
 
     // build json
     json json = {
@@ -0,0 +1,32 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Asset.h"
+#include "TransferTemplate.h"
+
+using namespace TW;
+using namespace TW::Ontology;
+
+std::vector<Transaction> Asset::transfers(const Signer &from,
+                                          const std::vector<std::pair<Address, uint64_t>> &recipients,
+                                          const Signer &payer, uint64_t gasPrice, uint64_t gasLimit,
+                                          uint32_t nonce) {
+    // ONT and ONG transfers are version 0, both the transaction and the invoked contract
+    const auto script = TransferTemplate(contractAddress(), 0x00);
+    const auto fromAddress = from.getAddress().data;
+    const auto payerAddress = payer.getAddress().string();
+
+    std::vector<Transaction> transactions;
+    transactions.reserve(recipients.size());
+    for (const auto &[to, amount] : recipients) {
+        auto &tx = transactions.emplace_back(0x00, txType, nonce++, gasPrice, gasLimit, payerAddress,
+                                             script.build(fromAddress, to.data, amount));
+        const auto hash = tx.txHash();
+        from.addSign(tx, hash);
+        payer.addSign(tx, hash);
+    }
+    return transactions;
+}
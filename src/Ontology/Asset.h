@@ -14,6 +14,7 @@
 
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace TW::Ontology {
@@ -32,5 +33,13 @@ class Asset {
     virtual Transaction transfer(const Signer &from, const Address &to, uint64_t amount,
                                  const Signer &payer, uint64_t gasPrice, uint64_t gasLimit,
                                  uint32_t nonce) = 0;
+
+    /// Builds and signs one transfer per recipient, the same as transfer() with nonces nonce, nonce + 1, ...
+    /// The transfer script is compiled once and patched per recipient, the signer addresses are converted once,
+    /// and each transaction is hashed once for both signatures.
+    std::vector<Transaction> transfers(const Signer &from,
+                                       const std::vector<std::pair<Address, uint64_t>> &recipients,
+                                       const Signer &payer, uint64_t gasPrice, uint64_t gasLimit,
+                                       uint32_t nonce);
 };
 } // namespace TW::Ontology
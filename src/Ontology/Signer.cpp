@@ -52,19 +52,18 @@ Address Signer::getAddress() const {
 }
 
 void Signer::sign(Transaction& tx) const {
-    if (tx.sigVec.size() >= Transaction::sigVecLimit) {
-        throw std::runtime_error("the number of transaction signatures should not be over 16.");
-    }
-    auto signature = getPrivateKey().sign(Hash::sha256(tx.txHash()), TWCurveNIST256p1);
-    signature.pop_back();
-    tx.sigVec.emplace_back(publicKey, signature, 1);
+    addSign(tx, tx.txHash());
 }
 
 void Signer::addSign(Transaction& tx) const {
+    addSign(tx, tx.txHash());
+}
+
+void Signer::addSign(Transaction& tx, const Data& txHash) const {
     if (tx.sigVec.size() >= Transaction::sigVecLimit) {
         throw std::runtime_error("the number of transaction signatures should not be over 16.");
     }
-    auto signature = getPrivateKey().sign(Hash::sha256(tx.txHash()), TWCurveNIST256p1);
+    auto signature = privateKey.sign(Hash::sha256(txHash), TWCurveNIST256p1);
     signature.pop_back();
     tx.sigVec.emplace_back(publicKey, signature, 1);
 }
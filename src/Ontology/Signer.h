@@ -39,6 +39,9 @@ class Signer {
     void sign(Transaction& tx) const;
 
     void addSign(Transaction& tx) const;
+
+    /// Adds a signature of a transaction hash (see Transaction::txHash) computed once for all its signers.
+    void addSign(Transaction& tx, const Data& txHash) const;
 };
 } // namespace TW::Ontology
 
@@ -0,0 +1,58 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "TransferTemplate.h"
+#include "OpCode.h"
+#include "ParamsBuilder.h"
+
+#include <boost/any.hpp>
+
+#include <algorithm>
+#include <list>
+#include <stdexcept>
+#include <vector>
+
+using namespace TW;
+using namespace TW::Ontology;
+
+TransferTemplate::TransferTemplate(const Data& contractAddress, uint8_t version) {
+    const auto zero = std::array<uint8_t, addressSize>{};
+    std::list<boost::any> transferParam{zero, zero, uint64_t(0)};
+    std::vector<boost::any> args{transferParam};
+    script = ParamsBuilder::buildNativeInvokeCode(contractAddress, version, "transfer", args);
+
+    // PUSH0 NEW_STRUCT TO_ALT_STACK, then each struct field pushed and followed by DUP_FROM_ALT_STACK SWAP HAS_KEY;
+    // an address push is its length byte and the 20 bytes
+    fromOffset = 3 + 1;
+    toOffset = fromOffset + addressSize + 3 + 1;
+    amountOffset = toOffset + addressSize + 3;
+    if (script.size() <= amountOffset || script[fromOffset - 1] != addressSize || script[toOffset - 1] != addressSize ||
+        script[amountOffset] != PUSH0) {
+        throw std::logic_error("Unexpected transfer script layout");
+    }
+}
+
+void TransferTemplate::build(const std::array<uint8_t, addressSize>& from, const std::array<uint8_t, addressSize>& to,
+                             uint64_t amount, Data& out) const {
+    ParamsBuilder amountBuilder;
+    amountBuilder.push(amount);
+    const auto amountBytes = amountBuilder.getBytes();
+
+    const auto start = out.size();
+    out.reserve(start + script.size() - 1 + amountBytes.size());
+    out.insert(out.end(), script.begin(), script.begin() + amountOffset);
+    std::copy(from.begin(), from.end(), out.begin() + start + fromOffset);
+    std::copy(to.begin(), to.end(), out.begin() + start + toOffset);
+    out.insert(out.end(), amountBytes.begin(), amountBytes.end());
+    out.insert(out.end(), script.begin() + amountOffset + 1, script.end());
+}
+
+Data TransferTemplate::build(const std::array<uint8_t, addressSize>& from, const std::array<uint8_t, addressSize>& to,
+                             uint64_t amount) const {
+    Data out;
+    build(from, to, amount, out);
+    return out;
+}
@@ -0,0 +1,44 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "../Data.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace TW::Ontology {
+
+/// Precompiled invocation script of a native asset (ONT, ONG) `transfer` call, with patch slots for the sender,
+/// the recipient and the amount.
+///
+/// The script is the one built by ParamsBuilder::buildNativeInvokeCode for a single [from, to, amount] transfer
+/// struct: it is compiled once per contract, and every transfer only copies it and patches the slots.
+class TransferTemplate {
+  public:
+    static const std::size_t addressSize = 20;
+
+    TransferTemplate(const Data& contractAddress, uint8_t version);
+
+    /// Appends the script for a transfer to out.
+    void build(const std::array<uint8_t, addressSize>& from, const std::array<uint8_t, addressSize>& to,
+               uint64_t amount, Data& out) const;
+
+    Data build(const std::array<uint8_t, addressSize>& from, const std::array<uint8_t, addressSize>& to,
+               uint64_t amount) const;
+
+  private:
+    /// Script with zero addresses and amount, the amount pushed as the single byte PUSH0.
+    Data script;
+
+    std::size_t fromOffset;
+    std::size_t toOffset;
+    std::size_t amountOffset;
+};
+
+} // namespace TW::Ontology
@@ -10,10 +10,12 @@
 #include "../Data.h"
 #include "../PublicKey.h"
 #include "../SS58Address.h"
+#include "../VarInt.h"
 #include <boost/multiprecision/cpp_int.hpp>
 #include <cmath>
 #include <algorithm>
 #include <bitset>
+#include <limits>
 
 
 /// Reference https://github.com/soramitsu/kagome/blob/master/core/scale/scale_encoder_stream.cpp
@@ -39,7 +41,17 @@ inline size_t countBytes(CompactInteger value) {
     return size;
 }
 
+inline Data encodeCompact(uint64_t value) {
+    auto data = Data(VarInt::scaleCompactLength(value));
+    VarInt::writeScaleCompact(value, data.data());
+    return data;
+}
+
 inline Data encodeCompact(CompactInteger value) {
+    if (value <= std::numeric_limits<uint64_t>::max()) {
+        return encodeCompact(value.convert_to<uint64_t>());
+    }
+
     auto data = Data{};
 
     if (value < kMinUint16) {
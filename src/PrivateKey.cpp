@@ -102,18 +102,25 @@ PrivateKey::PrivateKey(const Data& data, const Data& ext, const Data& chainCode)
 
 PublicKey PrivateKey::getPublicKey(TWPublicKeyType type) const {
     Data result;
+    // Compressed secp256k1 and nist256p1 keys keep the uncompressed encoding computed along the way.
+    std::array<byte, PublicKey::secp256k1ExtendedSize> extended;
+    const byte* extendedCache = nullptr;
+    const auto computeCompressed = [&](const ecdsa_curve* curve) {
+        ecdsa_get_public_key65(curve, bytes.data(), extended.data());
+        result.assign(extended.begin(), extended.begin() + PublicKey::secp256k1Size);
+        result[0] = 0x02 | (extended[64] & 0x01);
+        extendedCache = extended.data();
+    };
     switch (type) {
     case TWPublicKeyTypeSECP256k1:
-        result.resize(PublicKey::secp256k1Size);
-        ecdsa_get_public_key33(&secp256k1, bytes.data(), result.data());
+        computeCompressed(&secp256k1);
         break;
     case TWPublicKeyTypeSECP256k1Extended:
         result.resize(PublicKey::secp256k1ExtendedSize);
         ecdsa_get_public_key65(&secp256k1, bytes.data(), result.data());
         break;
     case TWPublicKeyTypeNIST256p1:
-        result.resize(PublicKey::secp256k1Size);
-        ecdsa_get_public_key33(&nist256p1, bytes.data(), result.data());
+        computeCompressed(&nist256p1);
         break;
     case TWPublicKeyTypeNIST256p1Extended:
         result.resize(PublicKey::secp256k1ExtendedSize);
@@ -143,7 +150,8 @@ PublicKey PrivateKey::getPublicKey(TWPublicKeyType type) const {
         ed25519_pk_to_curve25519(result.data(), ed25519PublicKey.bytes.data());
         break;
     }
-    return PublicKey(result, type);
+    // computed from a valid private key, no need to validate
+    return PublicKey(std::move(result), type, extendedCache);
 }
 
 Data PrivateKey::getSharedKey(const PublicKey& pubKey, TWCurve curve) const {
@@ -78,39 +78,71 @@ PublicKey::PublicKey(const Data& data, enum TWPublicKeyType type) : type(type) {
     }
 }
 
+PublicKey::PublicKey(Data&& data, enum TWPublicKeyType type, const byte* extended) noexcept
+    : bytes(std::move(data)), type(type) {
+    if (extended != nullptr) {
+        extendedCache.fill(extended, type == TWPublicKeyTypeSECP256k1 ? TWPublicKeyTypeSECP256k1Extended : TWPublicKeyTypeNIST256p1Extended);
+    }
+}
+
+PublicKey::ExtendedCache& PublicKey::ExtendedCache::operator=(const ExtendedCache& other) noexcept {
+    if (other.state.load(std::memory_order_acquire) == ready) {
+        bytes = other.bytes;
+        type = other.type;
+        state.store(ready, std::memory_order_release);
+    } else {
+        state.store(empty, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+void PublicKey::ExtendedCache::fill(const byte* extended, enum TWPublicKeyType extendedType) noexcept {
+    uint8_t expected = empty;
+    if (!state.compare_exchange_strong(expected, writing, std::memory_order_acquire)) {
+        return;
+    }
+    std::copy(extended, extended + secp256k1ExtendedSize, bytes.begin());
+    type = extendedType;
+    state.store(ready, std::memory_order_release);
+}
+
+bool PublicKey::hasCachedExtended() const {
+    if (extendedCache.state.load(std::memory_order_acquire) != ExtendedCache::ready) {
+        return false;
+    }
+    const auto& cached = extendedCache.bytes;
+    const auto expectedType = type == TWPublicKeyTypeSECP256k1 ? TWPublicKeyTypeSECP256k1Extended : TWPublicKeyTypeNIST256p1Extended;
+    // the x coordinate and the parity of y identify the point
+    return extendedCache.type == expectedType && bytes.size() == secp256k1Size &&
+           bytes[0] == (0x02 | (cached[64] & 0x01)) &&
+           std::equal(bytes.begin() + 1, bytes.end(), cached.begin() + 1);
+}
+
 PublicKey PublicKey::compressed() const {
     if (type != TWPublicKeyTypeSECP256k1Extended && type != TWPublicKeyTypeNIST256p1Extended) {
         return *this;
     }
+    const auto compressedType = type == TWPublicKeyTypeSECP256k1Extended ? TWPublicKeyTypeSECP256k1 : TWPublicKeyTypeNIST256p1;
 
     Data newBytes(secp256k1Size);
     assert(bytes.size() >= 65);
     newBytes[0] = 0x02 | (bytes[64] & 0x01);
+    std::copy(bytes.begin() + 1, bytes.begin() + secp256k1Size, newBytes.begin() + 1);
 
-    assert(type == TWPublicKeyTypeSECP256k1Extended || type == TWPublicKeyTypeNIST256p1Extended);
-    switch (type) {
-    case TWPublicKeyTypeSECP256k1Extended:
-        std::copy(bytes.begin() + 1, bytes.begin() + secp256k1Size, newBytes.begin() + 1);
-        return PublicKey(newBytes, TWPublicKeyTypeSECP256k1);
-
-    case TWPublicKeyTypeNIST256p1Extended:
-    default:
-        std::copy(bytes.begin() + 1, bytes.begin() + secp256k1Size, newBytes.begin() + 1);
-        return PublicKey(newBytes, TWPublicKeyTypeNIST256p1);
-    }
+    // extended() on the result needs no decompression
+    return PublicKey(std::move(newBytes), compressedType, bytes.data());
 }
 
 PublicKey PublicKey::extended() const {
-    Data newBytes(secp256k1ExtendedSize);
+    const ecdsa_curve* curve = nullptr;
     switch (type) {
     case TWPublicKeyTypeSECP256k1:
-        ecdsa_uncompress_pubkey(&secp256k1, bytes.data(), newBytes.data());
-        return PublicKey(newBytes, TWPublicKeyTypeSECP256k1Extended);
-    case TWPublicKeyTypeSECP256k1Extended:
-        return *this;
+        curve = &secp256k1;
+        break;
     case TWPublicKeyTypeNIST256p1:
-        ecdsa_uncompress_pubkey(&nist256p1, bytes.data(), newBytes.data());
-        return PublicKey(newBytes, TWPublicKeyTypeNIST256p1Extended);
+        curve = &nist256p1;
+        break;
+    case TWPublicKeyTypeSECP256k1Extended:
     case TWPublicKeyTypeNIST256p1Extended:
         return *this;
     case TWPublicKeyTypeED25519:
@@ -119,6 +151,19 @@ PublicKey PublicKey::extended() const {
     case TWPublicKeyTypeED25519Extended:
        return *this;
     }
+    const auto extendedType = type == TWPublicKeyTypeSECP256k1 ? TWPublicKeyTypeSECP256k1Extended : TWPublicKeyTypeNIST256p1Extended;
+
+    if (hasCachedExtended()) {
+        return PublicKey(Data(extendedCache.bytes.begin(), extendedCache.bytes.end()), extendedType, nullptr);
+    }
+
+    Data newBytes(secp256k1ExtendedSize);
+    if (bytes.size() != secp256k1Size || ecdsa_uncompress_pubkey(curve, bytes.data(), newBytes.data()) != 1) {
+        throw std::invalid_argument("Invalid public key data");
+    }
+    // a no-op if the cache holds an encoding of bytes that have since changed
+    extendedCache.fill(newBytes.data(), extendedType);
+    return PublicKey(std::move(newBytes), extendedType, nullptr);
 }
 
 bool PublicKey::verify(const Data& signature, const Data& message) const {
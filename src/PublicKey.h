@@ -11,6 +11,8 @@
 
 #include <TrustWalletCore/TWPublicKeyType.h>
 
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <stdexcept>
 
@@ -56,6 +58,10 @@ class PublicKey {
     PublicKey compressed() const;
 
     /// Returns an extended version of this public key.
+    ///
+    /// The point decompression runs at most once per key: the result is cached, and copied along with the key.
+    ///
+    /// @throws std::invalid_argument if the key is not a point on its curve.
     PublicKey extended() const;
 
     /// Verifies a signature for the provided message.
@@ -75,6 +81,36 @@ class PublicKey {
 
     /// Check if this key makes a valid ED25519 key (it is on the curve)
     bool isValidED25519() const;
+
+  private:
+    friend class PrivateKey;
+
+    /// Uncompressed encoding of a compressed secp256k1 or nist256p1 key, filled in once by extended() or when the
+    /// key is created from an uncompressed one.  Only used while it still matches `bytes` and `type`.
+    struct ExtendedCache {
+        enum State : uint8_t { empty, writing, ready };
+
+        std::array<byte, secp256k1ExtendedSize> bytes{};
+        enum TWPublicKeyType type = TWPublicKeyTypeSECP256k1;
+        /// Goes from empty to ready at most once, so that a const key can be shared between threads.
+        std::atomic<uint8_t> state{empty};
+
+        ExtendedCache() = default;
+        ExtendedCache(const ExtendedCache& other) noexcept { *this = other; }
+        ExtendedCache& operator=(const ExtendedCache& other) noexcept;
+
+        /// Stores the encoding, unless the cache is already filled or being filled by another thread.
+        void fill(const byte* extended, enum TWPublicKeyType extendedType) noexcept;
+    };
+
+    mutable ExtendedCache extendedCache;
+
+    /// Initializes a public key with bytes known to be valid, such as computed from a private key, and optionally
+    /// the uncompressed encoding of a compressed key.
+    PublicKey(Data&& data, enum TWPublicKeyType type, const byte* extended) noexcept;
+
+    /// Whether extendedCache holds the uncompressed encoding of this key.
+    bool hasCachedExtended() const;
 };
 
 inline bool operator==(const PublicKey& lhs, const PublicKey& rhs) {
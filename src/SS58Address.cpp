@@ -0,0 +1,71 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "SS58Address.h"
+
+#include <TrezorCrypto/blake2b.h>
+
+#include <algorithm>
+
+using namespace TW;
+
+namespace {
+
+/// blake2b-512 state that has absorbed the checksum prefix; every checksum starts from a copy of it.
+const BLAKE2B_CTX& prefixState() {
+    static const BLAKE2B_CTX state = [] {
+        BLAKE2B_CTX context;
+        blake2b_Init(&context, BLAKE2B_DIGEST_LENGTH);
+        blake2b_Update(&context, SS58Prefix.data(), SS58Prefix.size());
+        return context;
+    }();
+    return state;
+}
+
+} // namespace
+
+SS58Address::Checksum SS58Address::checksum(const byte* data, size_t dataSize) {
+    auto context = prefixState();
+    blake2b_Update(&context, data, dataSize);
+    byte hash[BLAKE2B_DIGEST_LENGTH];
+    blake2b_Final(&context, hash, sizeof(hash));
+    Checksum result;
+    std::copy(hash, hash + checksumSize, result.begin());
+    return result;
+}
+
+bool SS58Address::decode(const std::string& string, byte network, std::array<byte, size>& result) {
+    std::array<byte, size + checksumSize> decoded;
+    if (!Base58::bitcoin.decode(string.data(), string.data() + string.size(), decoded.data(), decoded.size())) {
+        return false;
+    }
+    // check network
+    if (decoded[0] != network) {
+        return false;
+    }
+    // compare checksum
+    const auto sum = checksum(decoded.data(), size);
+    if (!std::equal(sum.begin(), sum.end(), decoded.begin() + size)) {
+        return false;
+    }
+    std::copy(decoded.begin(), decoded.begin() + size, result.begin());
+    return true;
+}
+
+bool SS58Address::isValid(const std::string& string, byte network) {
+    std::array<byte, size> bytes;
+    return decode(string, network, bytes);
+}
+
+std::vector<bool> SS58Address::validate(const std::vector<std::string>& strings, byte network) {
+    std::vector<bool> result;
+    result.reserve(strings.size());
+    std::array<byte, size> bytes;
+    for (const auto& string : strings) {
+        result.push_back(decode(string, network, bytes));
+    }
+    return result;
+}
@@ -13,6 +13,7 @@
 #include <array>
 #include <string>
 #include <iostream>
+#include <vector>
 
 const std::string SS58Prefix = "SS58PRE";
 
@@ -28,43 +29,33 @@ class SS58Address {
     /// Address data consisting of a network byte followed by the public key.
     std::array<byte, size> bytes;
 
+    using Checksum = std::array<byte, checksumSize>;
+
     /// Determines whether a string makes a valid address
-    static bool isValid(const std::string& string, byte network) {
-        const auto decoded = Base58::bitcoin.decode(string);
-        if (decoded.size() != SS58Address::size + checksumSize) {
-            return false;
-        }
-        // check network
-        if (decoded[0] != network) {
-            return false;
-        }
-        auto checksum = computeChecksum(Data(decoded.begin(), decoded.end() - checksumSize));
-        // compare checksum
-        if (!std::equal(decoded.end() - checksumSize, decoded.end(), checksum.begin())) {
-            return false;
-        }
-        return true;
-    }
+    static bool isValid(const std::string& string, byte network);
+
+    /// Determines, for each string, whether it makes a valid address.
+    static std::vector<bool> validate(const std::vector<std::string>& strings, byte network);
+
+    /// Decodes a string into `result` (network byte followed by the public key); returns false if it's not a valid address.
+    static bool decode(const std::string& string, byte network, std::array<byte, size>& result);
+
+    /// Computes the checksum of address data, reusing a blake2b state that has already absorbed the prefix.
+    static Checksum checksum(const byte* data, size_t dataSize);
 
     template <typename T>
     static Data computeChecksum(const T& data) {
-        auto prefix = Data(SS58Prefix.begin(), SS58Prefix.end());
-        append(prefix, Data(data.begin(), data.end()));
-        auto hash = Hash::blake2b(prefix, 64);
-        auto checksum = Data(checksumSize);
-        std::copy(hash.begin(), hash.begin() + checksumSize, checksum.data());
-        return checksum;
+        const auto result = checksum(reinterpret_cast<const byte*>(data.data()), data.size());
+        return Data(result.begin(), result.end());
     }
 
     SS58Address() = default;
 
     /// Initializes an address with a string representation.
     SS58Address(const std::string& string, byte network) {
-        if (!isValid(string, network)) {
+        if (!decode(string, network, bytes)) {
             throw std::invalid_argument("Invalid address string");
         }
-        const auto decoded = Base58::bitcoin.decode(string);
-        std::copy(decoded.begin(), decoded.end() - checksumSize, bytes.begin());
     }
 
     /// Initializes an address with a public key and network.
@@ -78,9 +69,10 @@ class SS58Address {
 
     /// Returns a string representation of the address.
     std::string string() const {
-        auto result = Data(bytes.begin(), bytes.end());
-        auto checksum = computeChecksum(bytes);
-        append(result, checksum);
+        std::array<byte, size + checksumSize> result;
+        const auto sum = checksum(bytes.data(), bytes.size());
+        std::copy(bytes.begin(), bytes.end(), result.begin());
+        std::copy(sum.begin(), sum.end(), result.begin() + size);
         return Base58::bitcoin.encode(result);
     }
 
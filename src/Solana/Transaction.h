@@ -10,6 +10,7 @@
 #include "../Base58.h"
 #include "../BinaryCoding.h"
 #include "../Data.h"
+#include "../VarInt.h"
 
 #include <vector>
 #include <string>
@@ -30,20 +31,10 @@ const std::string NULL_ID_ADDRESS = "11111111111111111111111111111111";
 const std::string SYSVAR_STAKE_HISTORY_ID_ADDRESS = "SysvarStakeHistory1111111111111111111111111";
 
 template <typename T>
-Data shortVecLength(std::vector<T> vec) {
-    auto bytes = Data();
-    auto remLen = vec.size();
-    while (true) {
-        uint8_t elem = remLen & 0x7f;
-        remLen >>= 7;
-        if (remLen == 0) {
-            bytes.push_back(elem);
-            break;
-        } else {
-            elem |= 0x80;
-            bytes.push_back(elem);
-        }
-    }
+Data shortVecLength(const std::vector<T>& vec) {
+    // compact-u16, the same 7-bit groups as LEB128
+    auto bytes = Data(VarInt::leb128Length(vec.size()));
+    VarInt::writeLEB128(vec.size(), bytes.data());
     return bytes;
 }
 
@@ -9,6 +9,7 @@
 #include "../Base58.h"
 #include "../Data.h"
 #include "../HexCoding.h"
+#include "../VarInt.h"
 #include "../proto/Tezos.pb.h"
 
 #include <sstream>
@@ -61,12 +62,8 @@ Data forgePublicKey(PublicKey publicKey) {
 
 // Forge the given zarith hash into a hex encoded string.
 Data forgeZarith(uint64_t input) {
-    Data forged = Data();
-    while (input >= 0x80) {
-        forged.push_back(static_cast<byte>((input & 0xff) | 0x80));
-        input >>= 7;
-    }
-    forged.push_back(static_cast<byte>(input));
+    auto forged = Data(VarInt::leb128Length(input));
+    VarInt::writeLEB128(input, forged.data());
     return forged;
 }
 
@@ -308,20 +308,22 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     internal.mutable_raw_data()->set_fee_limit(input.transaction().fee_limit());
     setBlockReference(input.transaction(), internal);
 
-    output.set_ref_block_bytes(internal.raw_data().ref_block_bytes());
-    output.set_ref_block_hash(internal.raw_data().ref_block_hash());
-
     const auto serialized = internal.raw_data().SerializeAsString();
     const auto hash = Hash::sha256(Data(serialized.begin(), serialized.end()));
 
     const auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
     const auto signature = key.sign(hash, TWCurveSECP256k1);
 
-    const auto json = transactionJSON(internal, hash, signature).dump();
-
-    output.set_id(hash.data(), hash.size());
-    output.set_signature(signature.data(), signature.size());
-    output.set_json(json.data(), json.size());
+    if (input.output_format() != Common::Proto::Output_json) {
+        output.set_ref_block_bytes(internal.raw_data().ref_block_bytes());
+        output.set_ref_block_hash(internal.raw_data().ref_block_hash());
+        output.set_id(hash.data(), hash.size());
+        output.set_signature(signature.data(), signature.size());
+    }
+    if (input.output_format() != Common::Proto::Output_raw) {
+        const auto json = transactionJSON(internal, hash, signature).dump();
+        output.set_json(json.data(), json.size());
+    }
 
     return output;
 }
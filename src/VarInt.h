@@ -0,0 +1,244 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/// Variable-length integer encodings shared by the coin serializers.
+///
+/// Encoders write into a caller-provided buffer of at least the encoding's max size and return the number of bytes
+/// written; `append*` helpers go through a stack buffer so the output vector grows once. Decoders read at `index`,
+/// never past `size`, advance `index` on success and leave it untouched on failure.
+namespace TW::VarInt {
+
+/// Number of significant bits in a value, 0 for 0.
+inline std::size_t bitLength(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return value == 0 ? 0 : 64 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+    std::size_t length = 0;
+    while (value != 0) {
+        ++length;
+        value >>= 1;
+    }
+    return length;
+#endif
+}
+
+/// Writes `value` as `length` little-endian bytes.
+inline void writeLE(uint64_t value, std::size_t length, byte* out) {
+    for (std::size_t i = 0; i < length; ++i) {
+        out[i] = static_cast<byte>(value >> (8 * i));
+    }
+}
+
+/// Reads `length` little-endian bytes.
+inline uint64_t readLE(const byte* data, std::size_t length) {
+    uint64_t value = 0;
+    for (std::size_t i = 0; i < length; ++i) {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+// Bitcoin CompactSize: one byte below 0xfd, otherwise a 0xfd/0xfe/0xff marker and a 2/4/8-byte little-endian value.
+
+static constexpr std::size_t maxCompactSizeLength = 9;
+
+inline std::size_t compactSizeLength(uint64_t value) {
+    if (value < 0xfd) {
+        return 1;
+    }
+    if (value <= UINT16_MAX) {
+        return 3;
+    }
+    return value <= UINT32_MAX ? 5 : 9;
+}
+
+inline std::size_t writeCompactSize(uint64_t value, byte* out) {
+    const auto length = compactSizeLength(value);
+    switch (length) {
+    case 1:
+        out[0] = static_cast<byte>(value);
+        return 1;
+    case 3:
+        out[0] = 0xfd;
+        break;
+    case 5:
+        out[0] = 0xfe;
+        break;
+    default:
+        out[0] = 0xff;
+        break;
+    }
+    writeLE(value, length - 1, out + 1);
+    return length;
+}
+
+inline bool readCompactSize(const byte* data, std::size_t size, std::size_t& index, uint64_t& value) {
+    if (index >= size) {
+        return false;
+    }
+    const auto first = data[index];
+    std::size_t length = 0;
+    switch (first) {
+    case 0xfd: length = 2; break;
+    case 0xfe: length = 4; break;
+    case 0xff: length = 8; break;
+    default:
+        value = first;
+        index += 1;
+        return true;
+    }
+    if (size - index - 1 < length) {
+        return false;
+    }
+    value = readLE(data + index + 1, length);
+    index += 1 + length;
+    return true;
+}
+
+// Unsigned LEB128: 7 bits per byte, least significant group first, high bit set on all but the last byte.
+// Used by Tezos (zarith naturals), EOS (varuint32), Solana (short_vec) and Filecoin (ID addresses).
+
+static constexpr std::size_t maxLEB128Length = 10;
+
+inline std::size_t leb128Length(uint64_t value) {
+    return 1 + (bitLength(value | 1) - 1) / 7;
+}
+
+inline std::size_t writeLEB128(uint64_t value, byte* out) {
+    const auto length = leb128Length(value);
+    for (std::size_t i = 0; i + 1 < length; ++i) {
+        out[i] = static_cast<byte>(value) | 0x80;
+        value >>= 7;
+    }
+    out[length - 1] = static_cast<byte>(value);
+    return length;
+}
+
+/// Rejects encodings that do not terminate within `size` or overflow 64 bits.
+inline bool readLEB128(const byte* data, std::size_t size, std::size_t& index, uint64_t& value) {
+    uint64_t result = 0;
+    for (std::size_t i = 0; i < maxLEB128Length && index + i < size; ++i) {
+        const auto b = data[index + i];
+        if (i == maxLEB128Length - 1 && b > 1) {
+            return false;
+        }
+        result |= static_cast<uint64_t>(b & 0x7f) << (7 * i);
+        if ((b & 0x80) == 0) {
+            value = result;
+            index += i + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Minimal big-endian bytes, at least one byte; used for RLP lengths.
+
+static constexpr std::size_t maxBigEndianLength = 8;
+
+inline std::size_t bigEndianLength(uint64_t value) {
+    return 1 + (bitLength(value | 1) - 1) / 8;
+}
+
+inline std::size_t writeBigEndian(uint64_t value, byte* out) {
+    const auto length = bigEndianLength(value);
+    for (std::size_t i = 0; i < length; ++i) {
+        out[i] = static_cast<byte>(value >> (8 * (length - 1 - i)));
+    }
+    return length;
+}
+
+// SCALE compact integers (Polkadot, Kusama): the two low bits of the first byte select a 1, 2 or 4-byte
+// little-endian value shifted left by two, or a length-prefixed little-endian value of 4 to 8 bytes (up to 67 in
+// SCALE, but only 8 fit here).
+
+static constexpr std::size_t maxScaleCompactLength = 9;
+
+inline std::size_t scaleCompactLength(uint64_t value) {
+    if (value < (uint64_t(1) << 6)) {
+        return 1;
+    }
+    if (value < (uint64_t(1) << 14)) {
+        return 2;
+    }
+    if (value < (uint64_t(1) << 30)) {
+        return 4;
+    }
+    return 1 + std::max<std::size_t>(4, (bitLength(value) + 7) / 8);
+}
+
+inline std::size_t writeScaleCompact(uint64_t value, byte* out) {
+    const auto length = scaleCompactLength(value);
+    switch (length) {
+    case 1:
+    case 2:
+    case 4:
+        // mode 0b00, 0b01 or 0b10 is length / 2
+        writeLE((value << 2) | (length / 2), length, out);
+        return length;
+    default:
+        out[0] = static_cast<byte>(((length - 1 - 4) << 2) | 0x03);
+        writeLE(value, length - 1, out + 1);
+        return length;
+    }
+}
+
+/// Rejects big-integer modes that do not fit in 64 bits.
+inline bool readScaleCompact(const byte* data, std::size_t size, std::size_t& index, uint64_t& value) {
+    if (index >= size) {
+        return false;
+    }
+    const auto first = data[index];
+    const auto mode = first & 0x03;
+    if (mode == 0x03) {
+        const std::size_t length = (first >> 2) + 4;
+        if (length > 8 || size - index - 1 < length) {
+            return false;
+        }
+        value = readLE(data + index + 1, length);
+        index += 1 + length;
+        return true;
+    }
+    const std::size_t length = std::size_t(1) << mode;
+    if (size - index < length) {
+        return false;
+    }
+    value = readLE(data + index, length) >> 2;
+    index += length;
+    return true;
+}
+
+// Appending helpers
+
+inline void appendCompactSize(uint64_t value, Data& out) {
+    byte buffer[maxCompactSizeLength];
+    out.insert(out.end(), buffer, buffer + writeCompactSize(value, buffer));
+}
+
+inline void appendLEB128(uint64_t value, Data& out) {
+    byte buffer[maxLEB128Length];
+    out.insert(out.end(), buffer, buffer + writeLEB128(value, buffer));
+}
+
+inline void appendBigEndian(uint64_t value, Data& out) {
+    byte buffer[maxBigEndianLength];
+    out.insert(out.end(), buffer, buffer + writeBigEndian(value, buffer));
+}
+
+inline void appendScaleCompact(uint64_t value, Data& out) {
+    byte buffer[maxScaleCompactLength];
+    out.insert(out.end(), buffer, buffer + writeScaleCompact(value, buffer));
+}
+
+} // namespace TW::VarInt
@@ -19,8 +19,12 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     Data signature = Signer::sign(privateKey, transaction);
 
     Proto::SigningOutput output = Proto::SigningOutput();
-    output.set_signature(reinterpret_cast<const char *>(signature.data()), signature.size());
-    output.set_json(transaction.buildJson(signature).dump());
+    if (input.output_format() != Common::Proto::Output_json) {
+        output.set_signature(reinterpret_cast<const char *>(signature.data()), signature.size());
+    }
+    if (input.output_format() != Common::Proto::Output_raw) {
+        output.set_json(transaction.buildJson(signature).dump());
+    }
     return output;
 }
 
@@ -93,8 +93,15 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     Address address;
     const auto preImage = Signer::getPreImage(input, address);
     const auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
-    const auto pubKey = key.getPublicKey(TWPublicKeyTypeSECP256k1);
     const auto signature = key.signSchnorr(preImage, TWCurveSECP256k1);
+    if (input.output_format() != Common::Proto::Output_json) {
+        output.set_signature(signature.data(), signature.size());
+    }
+    if (input.output_format() == Common::Proto::Output_raw) {
+        return output;
+    }
+
+    const auto pubKey = key.getPublicKey(TWPublicKeyTypeSECP256k1);
     const auto transaction = input.transaction();
 
     // build json
@@ -125,7 +132,6 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     }
 
     output.set_json(json.dump());
-    output.set_signature(signature.data(), signature.size());
 
     return output;
 }
@@ -44,8 +44,13 @@ struct TWPublicKey *_Nonnull TWPublicKeyCompressed(struct TWPublicKey *_Nonnull
     return new TWPublicKey{ pk->impl.compressed() };
 }
 
-struct TWPublicKey *_Nonnull TWPublicKeyUncompressed(struct TWPublicKey *_Nonnull pk) {
-    return new TWPublicKey{ pk->impl.extended() };
+struct TWPublicKey *_Nullable TWPublicKeyUncompressed(struct TWPublicKey *_Nonnull pk) {
+    try {
+        return new TWPublicKey{ pk->impl.extended() };
+    } catch (const std::invalid_argument&) {
+        // not a point on the curve
+        return nullptr;
+    }
 }
 
 bool TWPublicKeyVerify(struct TWPublicKey *_Nonnull pk, TWData *signature, TWData *message) {
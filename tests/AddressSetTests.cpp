@@ -0,0 +1,109 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "AddressSet.h"
+#include "AnyAddress.h"
+#include "HDWallet.h"
+#include "Hash.h"
+#include "HexCoding.h"
+#include "Bitcoin/Address.h"
+#include "Bitcoin/Script.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace TW {
+
+// abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about
+const std::string addressSetZpub = "zpub6rFR7y4Q2AijBEqTUquhVz398htDFrtymD9xYYfG1m4wAcvPhXNfE3EfH1r1ADqtfSdVCToUG868RvUUkgDKf31mGDtKsAYz2oz2AGutZYs";
+
+TEST(AddressSet, InsertContains) {
+    AddressSet set;
+    const auto keyHash = parse_hex("751e76e8199196d454941c45d1b3a323f1433bd6");
+    EXPECT_FALSE(set.contains(TWCoinTypeBitcoin, keyHash));
+
+    EXPECT_TRUE(set.insert(TWCoinTypeBitcoin, keyHash));
+    EXPECT_FALSE(set.insert(TWCoinTypeBitcoin, keyHash));
+    EXPECT_EQ(set.size(), 1);
+
+    EXPECT_TRUE(set.contains(TWCoinTypeBitcoin, keyHash));
+    // keyed by coin too
+    EXPECT_FALSE(set.contains(TWCoinTypeLitecoin, keyHash));
+    // and by the whole payload
+    EXPECT_FALSE(set.contains(TWCoinTypeBitcoin, Data(keyHash.begin(), keyHash.end() - 1)));
+    EXPECT_FALSE(set.contains(TWCoinTypeBitcoin, parse_hex("751e76e8199196d454941c45d1b3a323f1433bd7")));
+}
+
+TEST(AddressSet, Grow) {
+    AddressSet set;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(set.insert(TWCoinTypeEthereum, Hash::sha256(Data{byte(i), byte(i >> 8)})));
+    }
+    EXPECT_EQ(set.size(), 1000);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(set.contains(TWCoinTypeEthereum, Hash::sha256(Data{byte(i), byte(i >> 8)})));
+    }
+    for (uint32_t i = 1000; i < 2000; ++i) {
+        EXPECT_FALSE(set.contains(TWCoinTypeEthereum, Hash::sha256(Data{byte(i), byte(i >> 8)})));
+    }
+}
+
+TEST(AddressSet, InsertPublicKey) {
+    AddressSet set;
+    const auto publicKey = PublicKey(parse_hex("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"), TWPublicKeyTypeSECP256k1);
+    EXPECT_TRUE(set.insert(TWCoinTypeBitcoin, publicKey));
+    EXPECT_TRUE(set.contains(TWCoinTypeBitcoin, parse_hex("751e76e8199196d454941c45d1b3a323f1433bd6")));
+
+    // the same bytes as AnyAddress
+    const auto ethereumKey = publicKey.extended();
+    EXPECT_TRUE(set.insert(TWCoinTypeEthereum, ethereumKey));
+    EXPECT_TRUE(set.contains(TWCoinTypeEthereum, AnyAddress::createWithPublicKey(ethereumKey, TWCoinTypeEthereum).data));
+
+    // no payload accessor for Tezos addresses
+    const auto tezosKey = PublicKey(parse_hex("c0257fd7d4f8a5b1e0e4d4ed1c1e1d1e3c0ffee1c0ffee1c0ffee1c0ffee1c0f"), TWPublicKeyTypeED25519);
+    EXPECT_THROW(set.insert(TWCoinTypeTezos, tezosKey), std::invalid_argument);
+}
+
+TEST(AddressSet, InsertRange) {
+    AddressSet set;
+    EXPECT_EQ(set.insertRange(TWCoinTypeBitcoin, addressSetZpub, 0, 0, 20), 20);
+    EXPECT_EQ(set.insertRange(TWCoinTypeBitcoin, addressSetZpub, 0, 10, 20), 10);
+    EXPECT_EQ(set.size(), 30);
+
+    const auto first = AnyAddress::createWithString("bc1qcr8te4kr609gcawutmrza0j4xv80jy8z306fyu", TWCoinTypeBitcoin);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_TRUE(set.contains(TWCoinTypeBitcoin, first->data));
+
+    EXPECT_THROW(set.insertRange(TWCoinTypeBitcoin, "invalid", 0, 0, 20), std::invalid_argument);
+    EXPECT_THROW(set.insertRange(TWCoinTypeBitcoin, addressSetZpub, 0, 0x80000000, 1), std::invalid_argument);
+    EXPECT_EQ(set.insertRange(TWCoinTypeBitcoin, "invalid", 0, 0, 0), 0);
+}
+
+TEST(AddressSet, ContainsScript) {
+    AddressSet set;
+    const auto publicKey = PublicKey(parse_hex("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"), TWPublicKeyTypeSECP256k1);
+    const auto keyHash = parse_hex("751e76e8199196d454941c45d1b3a323f1433bd6");
+    const auto scriptHash = parse_hex("4733f37cf4db86fbc2efed2500b4f4e49f312023");
+    set.insert(TWCoinTypeBitcoin, keyHash);
+    set.insert(TWCoinTypeBitcoin, scriptHash);
+
+    EXPECT_TRUE(set.containsScript(TWCoinTypeBitcoin, Bitcoin::Script::buildPayToPublicKeyHash(keyHash)));
+    EXPECT_TRUE(set.containsScript(TWCoinTypeBitcoin, Bitcoin::Script::buildPayToWitnessPublicKeyHash(keyHash)));
+    EXPECT_TRUE(set.containsScript(TWCoinTypeBitcoin, Bitcoin::Script::buildPayToPublicKey(publicKey.bytes)));
+    EXPECT_TRUE(set.containsScript(TWCoinTypeBitcoin, Bitcoin::Script::buildPayToScriptHash(scriptHash)));
+    EXPECT_FALSE(set.containsScript(TWCoinTypeLitecoin, Bitcoin::Script::buildPayToPublicKeyHash(keyHash)));
+    EXPECT_FALSE(set.containsScript(TWCoinTypeBitcoin, Bitcoin::Script::buildPayToPublicKeyHash(Data(20))));
+    EXPECT_FALSE(set.containsScript(TWCoinTypeBitcoin, Bitcoin::Script(parse_hex("6a04deadbeef"))));
+
+    // populated from an xpub, matched against the outputs paying to it
+    AddressSet owned;
+    owned.insertRange(TWCoinTypeBitcoin, addressSetZpub, 0, 0, 5);
+    EXPECT_TRUE(owned.containsScript(TWCoinTypeBitcoin, Bitcoin::Script::lockScriptForAddress("bc1qcr8te4kr609gcawutmrza0j4xv80jy8z306fyu", TWCoinTypeBitcoin)));
+    EXPECT_FALSE(owned.containsScript(TWCoinTypeBitcoin, Bitcoin::Script::lockScriptForAddress("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4", TWCoinTypeBitcoin)));
+}
+
+} // namespace TW
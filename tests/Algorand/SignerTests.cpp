@@ -197,3 +197,101 @@ TEST(AlgorandSigner, ProtoSignerAssetTransaction) {
 
     ASSERT_EQ(hex(encoded), "82a3736967c440412720eff99a17280a437bdb8eeba7404b855d6433fffd5dde7f7966c1f9ae531a1af39e18b8a58b4a6c6acb709cca92f8a18c36d8328be9520c915311027005a374786e8aa461616d74ce000f4240a461726376c420325164cafa253b116f4b54c63bd960d610209d44df635d65e095f3855a96b956a3666565cd0924a26676ce00f0b7c3a367656eac746573746e65742d76312e30a26768c4204863b518a4b3c84ec810f22d4f1081cb0f71f059a7ac20dec62f7f70e5093a22a26c76ce00f0bbaba3736e64c42082872d60c338cb928006070e02ec0942addcb79e7fbd01c76458aea526899bd3a474797065a56178666572a478616964ce00cc264a");
 }
+
+TEST(AlgorandSigner, TransactionId) {
+    // https://testnet.algoexplorer.io/tx/NJ62HYO2LC222AVLIN2GW5LKIWKLGC7NZLIQ3DUL2RDVRYO2UW7A
+    auto transaction = parse_hex("8aa461616d74ce000f4240a461726376c420325164cafa253b116f4b54c63bd960d610209d44df635d65e095f3855a96b956a3666565cd0924a26676ce00f0b7c3a367656eac746573746e65742d76312e30a26768c4204863b518a4b3c84ec810f22d4f1081cb0f71f059a7ac20dec62f7f70e5093a22a26c76ce00f0bbaba3736e64c42082872d60c338cb928006070e02ec0942addcb79e7fbd01c76458aea526899bd3a474797065a56178666572a478616964ce00cc264a");
+    ASSERT_EQ(hex(Signer::transactionId(transaction)), "6a7da3e1da58b5ad02ab43746b756a4594b30bedcad10d8e8bd44758e1daa5be");
+}
+
+TEST(AlgorandSigner, GroupId) {
+    auto ids = std::vector<Data>{
+        parse_hex("6a7da3e1da58b5ad02ab43746b756a4594b30bedcad10d8e8bd44758e1daa5be"),
+        parse_hex("e7d64d425c0f5be414f7751ba6269313a023b71e007604e0825710cd570a48d5"),
+    };
+    ASSERT_EQ(hex(Signer::groupId(ids)), "05b583f11bf4b821cf91dbcdb9d8f9d2587a77b1f8ef3890e89a87c3fce3a9ce");
+}
+
+TEST(AlgorandSigner, TemplateMatchesTransactions) {
+    auto key = PrivateKey(parse_hex("5a6a3cfe5ff4cc44c19381d15a0d16de2a76ee5c9b9d83b232e38cb5a2c84b04"));
+    auto from = Address(key.getPublicKey(TWPublicKeyTypeED25519));
+    auto to = Address("GJIWJSX2EU5RC32LKTDDXWLA2YICBHKE35RV2ZPASXZYKWUWXFLKNFSS4U");
+    std::string genesisId = "testnet-v1.0";
+    auto genesisHash = Base64::decode("SGO1GKSzyE7IEPItTxCByw9x8FmnrCDexi9/cOUJOiI=");
+
+    for (auto note : {Data(), parse_hex("68656c6c6f")}) {
+        auto txTemplate = TransactionTemplate(from, 2340, 15775683, 15776683, note, genesisId, genesisHash);
+
+        auto transfer = Transfer(from, to, 2340, 847, 15775683, 15776683, note, "pay", genesisId, genesisHash);
+        EXPECT_EQ(hex(txTemplate.serialize({to, 847, 0}, {})), hex(transfer.serialize()));
+
+        auto assetTransfer = AssetTransfer(from, to, 2340, 1000000, 13379146, 15775683, 15776683, note, "axfer", genesisId, genesisHash);
+        EXPECT_EQ(hex(txTemplate.serialize({to, 1000000, 13379146}, {})), hex(assetTransfer.serialize()));
+    }
+}
+
+TEST(AlgorandSigner, SignBatch) {
+    // https://testnet.algoexplorer.io/tx/NJ62HYO2LC222AVLIN2GW5LKIWKLGC7NZLIQ3DUL2RDVRYO2UW7A
+    auto key = PrivateKey(parse_hex("5a6a3cfe5ff4cc44c19381d15a0d16de2a76ee5c9b9d83b232e38cb5a2c84b04"));
+    auto from = Address(key.getPublicKey(TWPublicKeyTypeED25519));
+    auto to = Address("GJIWJSX2EU5RC32LKTDDXWLA2YICBHKE35RV2ZPASXZYKWUWXFLKNFSS4U");
+    auto txTemplate = TransactionTemplate(from, 2340, 15775683, 15776683, {}, "testnet-v1.0",
+                                          Base64::decode("SGO1GKSzyE7IEPItTxCByw9x8FmnrCDexi9/cOUJOiI="));
+
+    auto transfers = std::vector<BatchTransfer>(50, BatchTransfer{to, 1000000, 13379146});
+    transfers[7].amount = 5;
+    auto result = Signer::signBatch(key, txTemplate, transfers, 0);
+
+    ASSERT_EQ(result.size(), 50);
+    EXPECT_EQ(hex(result[0]), "82a3736967c440412720eff99a17280a437bdb8eeba7404b855d6433fffd5dde7f7966c1f9ae531a1af39e18b8a58b4a6c6acb709cca92f8a18c36d8328be9520c915311027005a374786e8aa461616d74ce000f4240a461726376c420325164cafa253b116f4b54c63bd960d610209d44df635d65e095f3855a96b956a3666565cd0924a26676ce00f0b7c3a367656eac746573746e65742d76312e30a26768c4204863b518a4b3c84ec810f22d4f1081cb0f71f059a7ac20dec62f7f70e5093a22a26c76ce00f0bbaba3736e64c42082872d60c338cb928006070e02ec0942addcb79e7fbd01c76458aea526899bd3a474797065a56178666572a478616964ce00cc264a");
+    EXPECT_EQ(result[49], result[0]);
+    EXPECT_NE(result[7], result[0]);
+}
+
+TEST(AlgorandSigner, SignBatchGroups) {
+    auto key = PrivateKey(parse_hex("c9d3cc16fecabe2747eab86b81528c6ed8b65efc1d6906d86aabc27187a1fe7c"));
+    auto publicKey = key.getPublicKey(TWPublicKeyTypeED25519);
+    auto from = Address(publicKey);
+    auto txTemplate = TransactionTemplate(from, 1000, 51, 1051, parse_hex("7061796f7574"), "mainnet-v1.0",
+                                          Base64::decode("wGHE2Pwdvd7S12BL5FaOP20EGYesN73ktiC1qzkkit8="));
+
+    auto transfers = std::vector<BatchTransfer>();
+    for (auto i = 0; i < 20; ++i) {
+        transfers.push_back({Address("UCE2U2JC4O4ZR6W763GUQCG57HQCDZEUJY4J5I6VYY4HQZUJDF7AKZO5GM"), uint64_t(100 + i), uint64_t(i % 2 == 0 ? 0 : 31566704)});
+    }
+    auto result = Signer::signBatch(key, txTemplate, transfers, Signer::maxGroupSize);
+    ASSERT_EQ(result.size(), 20);
+
+    // groups of 16 and 4 transactions, each ID computed from the transactions without the group field
+    for (auto [begin, end] : {std::make_pair(0, 16), std::make_pair(16, 20)}) {
+        auto ids = std::vector<Data>();
+        for (auto i = begin; i < end; ++i) {
+            ids.push_back(Signer::transactionId(txTemplate.serialize(transfers[i], {})));
+        }
+        auto group = Signer::groupId(ids);
+        for (auto i = begin; i < end; ++i) {
+            auto transaction = txTemplate.serialize(transfers[i], group);
+            Data message = {'T', 'X'};
+            append(message, transaction);
+
+            // {"sig": <64 bytes>, "txn": <transaction>}
+            ASSERT_EQ(result[i].size(), 1 + 4 + 2 + 64 + 4 + transaction.size());
+            auto signature = Data(result[i].begin() + 7, result[i].begin() + 7 + 64);
+            EXPECT_TRUE(publicKey.verify(signature, message));
+            EXPECT_EQ(hex(Data(result[i].end() - transaction.size(), result[i].end())), hex(transaction));
+        }
+    }
+}
+
+TEST(AlgorandSigner, SignBatchInvalid) {
+    auto key = PrivateKey(parse_hex("c9d3cc16fecabe2747eab86b81528c6ed8b65efc1d6906d86aabc27187a1fe7c"));
+    auto other = Address("UCE2U2JC4O4ZR6W763GUQCG57HQCDZEUJY4J5I6VYY4HQZUJDF7AKZO5GM");
+    auto genesisHash = Base64::decode("wGHE2Pwdvd7S12BL5FaOP20EGYesN73ktiC1qzkkit8=");
+    auto transfers = std::vector<BatchTransfer>(2, BatchTransfer{other, 1, 0});
+
+    auto foreignTemplate = TransactionTemplate(other, 1000, 51, 1051, {}, "mainnet-v1.0", genesisHash);
+    EXPECT_THROW(Signer::signBatch(key, foreignTemplate, transfers, 0), std::invalid_argument);
+
+    auto txTemplate = TransactionTemplate(Address(key.getPublicKey(TWPublicKeyTypeED25519)), 1000, 51, 1051, {}, "mainnet-v1.0", genesisHash);
+    EXPECT_THROW(Signer::signBatch(key, txTemplate, transfers, Signer::maxGroupSize + 1), std::invalid_argument);
+}
@@ -0,0 +1,117 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "AnyAddress.h"
+#include "Coin.h"
+#include "HexCoding.h"
+#include "PublicKey.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace TW {
+
+const std::vector<std::pair<TWCoinType, std::string>> anyAddressSamples = {
+    {TWCoinTypeEthereum, "0x4E5B2e1dc63F6b91cb6Cd759936495434C7e972F"},
+    {TWCoinTypeEthereum, "0x4e5b2e1dc63f6b91cb6cd759936495434c7e972f"},
+    {TWCoinTypeEthereum, "0x4E5B2e1dc63F6b91cb6Cd759936495434C7e972"},
+    {TWCoinTypeEthereum, "4E5B2e1dc63F6b91cb6Cd759936495434C7e972F00"},
+    {TWCoinTypeSmartChain, "0x4e5b2e1dc63f6b91cb6cd759936495434c7e972f"},
+    {TWCoinTypeTheta, "0x4e5b2e1dc63f6b91cb6cd759936495434c7e972f"},
+    {TWCoinTypeBitcoin, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"},
+    {TWCoinTypeBitcoin, "bc1pw508d6qejxtdg4y5r3zarvary0c5xw7kw508d6qejxtdg4y5r3zarvary0c5xw7kt5nd6y"},
+    {TWCoinTypeBitcoin, "1Bp9U1ogV3A14FMvKbRJms7ctyso4Z4Tcx"},
+    {TWCoinTypeLitecoin, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"},
+    {TWCoinTypeBitcoinCash, "bitcoincash:qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw"},
+    {TWCoinTypeBitcoinCash, "qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw"},
+    {TWCoinTypeBitcoinCash, "1Bp9U1ogV3A14FMvKbRJms7ctyso4Z4Tcx"},
+    {TWCoinTypeBitcoinCash, "qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqax"},
+    {TWCoinTypeCosmos, "cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02"},
+    {TWCoinTypeCosmos, "cosmos1xsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02"},
+    {TWCoinTypeKava, "cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02"},
+    {TWCoinTypeBinance, "bnb1hlly02l6ahjsgxw9wlcswnlwdhg4xhx38yxpd5"},
+    {TWCoinTypeDogecoin, "DQkiL71KkuGEgS9QFCKJkBeHmzM5YFYGkG"},
+    {TWCoinTypeQtum, "qc1qxssrzt03ncm0uda02vd8tuvrk0eg9wrz8qm2qe"},
+    {TWCoinTypeNEAR, "NEARTDDWrUMdoC2rA1eU6gNrSU2zyGKdR71TNucTvsQHyfAXjKcJb"},
+    {TWCoinTypeZilliqa, "zil1l8ddxvejeam70qang54wnqkgtmlu5mwlgzy64z"},
+    {TWCoinTypePolkadot, "16fir1SPRAaWGtF4ZkKNDq3S6LnD9mbphGXqL923DoH85Exz"},
+    {TWCoinTypeTezos, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"},
+    {TWCoinTypeBitcoin, ""},
+    {TWCoinTypeEthereum, ""},
+};
+
+TEST(AnyAddress, MatchesNormalizeAddress) {
+    for (const auto& [coin, string] : anyAddressSamples) {
+        const auto address = AnyAddress::createWithString(string, coin);
+        const auto normalized = normalizeAddress(coin, string);
+        EXPECT_EQ(address.has_value(), !normalized.empty()) << coin << " " << string;
+        if (address.has_value()) {
+            EXPECT_EQ(address->address, normalized) << coin << " " << string;
+            EXPECT_EQ(address->coin, coin);
+        }
+    }
+}
+
+TEST(AnyAddress, DecodedData) {
+    auto address = AnyAddress::createWithString("0x4e5b2e1dc63f6b91cb6cd759936495434c7e972f", TWCoinTypeEthereum);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_EQ(address->address, "0x4E5B2e1dc63F6b91cb6Cd759936495434C7e972F");
+    EXPECT_EQ(hex(address->data), "4e5b2e1dc63f6b91cb6cd759936495434c7e972f");
+
+    address = AnyAddress::createWithString("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4", TWCoinTypeBitcoin);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_EQ(hex(address->data), "751e76e8199196d454941c45d1b3a323f1433bd6");
+
+    // legacy address, no data
+    address = AnyAddress::createWithString("1Bp9U1ogV3A14FMvKbRJms7ctyso4Z4Tcx", TWCoinTypeBitcoin);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_TRUE(address->data.empty());
+
+    address = AnyAddress::createWithString("qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw", TWCoinTypeBitcoinCash);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_EQ(address->address, "bitcoincash:qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw");
+    EXPECT_EQ(hex(address->data), "8c97bbfa8f6e6d4a06e1f9cfb70ef4e9deadc10b");
+
+    address = AnyAddress::createWithString("cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02", TWCoinTypeCosmos);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_EQ(hex(address->data), "bc2da90c84049370d1b7c528bc164bc588833f21");
+
+    address = AnyAddress::createWithString("bnb1hlly02l6ahjsgxw9wlcswnlwdhg4xhx38yxpd5", TWCoinTypeBinance);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_EQ(hex(address->data), "bffe47abfaede50419c577f1074fee6dd1535cd1");
+
+    // valid, but not handled by the data extraction
+    address = AnyAddress::createWithString("qc1qxssrzt03ncm0uda02vd8tuvrk0eg9wrz8qm2qe", TWCoinTypeQtum);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_TRUE(address->data.empty());
+}
+
+TEST(AnyAddress, CreateWithStrings) {
+    const auto addresses = AnyAddress::createWithStrings({
+        "0x4e5b2e1dc63f6b91cb6cd759936495434c7e972f",
+        "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4",
+        "0x4E5B2e1dc63F6b91cb6Cd759936495434C7e972F",
+    }, TWCoinTypeEthereum);
+
+    ASSERT_EQ(addresses.size(), 3);
+    ASSERT_TRUE(addresses[0].has_value());
+    EXPECT_FALSE(addresses[1].has_value());
+    ASSERT_TRUE(addresses[2].has_value());
+    EXPECT_EQ(*addresses[0], *addresses[2]);
+    EXPECT_TRUE(AnyAddress::createWithStrings({}, TWCoinTypeEthereum).empty());
+}
+
+TEST(AnyAddress, CreateWithPublicKey) {
+    const auto publicKey = PublicKey(parse_hex("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"), TWPublicKeyTypeSECP256k1);
+    const auto address = AnyAddress::createWithPublicKey(publicKey, TWCoinTypeBitcoin);
+    EXPECT_EQ(address.address, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4");
+    EXPECT_EQ(address.coin, TWCoinTypeBitcoin);
+    EXPECT_EQ(hex(address.data), "751e76e8199196d454941c45d1b3a323f1433bd6");
+}
+
+} // namespace TW
@@ -0,0 +1,51 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Base58.h"
+#include "HexCoding.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+using namespace TW;
+
+namespace {
+
+bool decodeFixed(const std::string& string, Data& result) {
+    return Base58::bitcoin.decode(string.data(), string.data() + string.size(), result.data(), result.size());
+}
+
+} // namespace
+
+TEST(Base58, DecodeFixedSize) {
+    for (const auto string : {"1", "11", "z", "1112", "5Q", "5R", "1ES14c7qLb5CYhLMUekctxLgc1FV2Ti9DA", " 15KRsCq9LLNmCxNFhGk55s5bEyazKefunDxUH24GFZwsTxyu "}) {
+        const auto expected = Base58::bitcoin.decode(string);
+        Data result(expected.size());
+        EXPECT_TRUE(decodeFixed(string, result)) << string;
+        EXPECT_EQ(hex(result), hex(expected)) << string;
+    }
+}
+
+TEST(Base58, DecodeFixedSizeMismatch) {
+    Data result(2);
+    // one byte
+    EXPECT_FALSE(decodeFixed("z", result));
+    // three bytes
+    EXPECT_FALSE(decodeFixed("1112", result));
+    // 0xffff fits, 0x10000 does not
+    EXPECT_TRUE(decodeFixed("LUv", result));
+    EXPECT_EQ(hex(result), "ffff");
+    EXPECT_FALSE(decodeFixed("LUw", result));
+    // invalid characters and trailing data
+    EXPECT_FALSE(decodeFixed("L0v", result));
+    EXPECT_FALSE(decodeFixed("LUv x", result));
+    EXPECT_FALSE(decodeFixed("LU\xff", result));
+
+    Data empty;
+    EXPECT_TRUE(decodeFixed("", empty));
+    EXPECT_FALSE(decodeFixed("1", empty));
+}
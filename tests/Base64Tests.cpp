@@ -61,3 +61,85 @@ TEST(Base64, UrlFormat) {
     decoded = decodeBase64Url("EQA_qoVWKJl17JkayZlN-2E6vsTqAA1QlOY3kID1lOVZszC4");
     EXPECT_EQ(const1, hex(decoded));
 }
+
+namespace {
+
+/// Bit-by-bit reference encoder.
+std::string referenceEncode(const Data& data, const char* alphabet) {
+    std::string result;
+    uint32_t bits = 0;
+    int count = 0;
+    for (auto b : data) {
+        bits = (bits << 8) | b;
+        count += 8;
+        while (count >= 6) {
+            count -= 6;
+            result.push_back(alphabet[(bits >> count) & 0x3f]);
+        }
+    }
+    if (count > 0) {
+        result.push_back(alphabet[(bits << (6 - count)) & 0x3f]);
+    }
+    while (result.size() % 4 != 0) {
+        result.push_back('=');
+    }
+    return result;
+}
+
+const char* standardAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char* urlAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+} // namespace
+
+TEST(Base64, RoundTripLengths) {
+    // covers the vectorized blocks and every tail length
+    Data data;
+    uint32_t x = 0x12345678;
+    for (size_t size = 0; size <= 200; ++size) {
+        const auto encoded = encode(data);
+        ASSERT_EQ(encoded, referenceEncode(data, standardAlphabet)) << size;
+        ASSERT_EQ(encodeBase64Url(data), referenceEncode(data, urlAlphabet)) << size;
+        ASSERT_EQ(hex(decode(encoded)), hex(data)) << size;
+        ASSERT_EQ(hex(decodeBase64Url(encodeBase64Url(data))), hex(data)) << size;
+
+        x = x * 1103515245 + 12345;
+        data.push_back(static_cast<byte>(x >> 16));
+    }
+}
+
+TEST(Base64, DecodeUnpaddedAndZeros) {
+    EXPECT_EQ(hex(decode("MQ")), hex(data("1")));
+    EXPECT_EQ(hex(decode("MTI")), hex(data("12")));
+    // trailing zero bytes are data
+    EXPECT_EQ(hex(decode("AA==")), "00");
+    EXPECT_EQ(hex(decode("AAAA")), "000000");
+    EXPECT_EQ(hex(decode("MQA=")), "3100");
+}
+
+TEST(Base64, DecodeInvalid) {
+    for (const auto* invalid : {"M", "MQ=", "MQ===", "MTIz=", "MTIzN", "MR==", "MTJ=", "M=Q=", "MT I", "MT\xffI"}) {
+        EXPECT_THROW(decode(invalid), std::invalid_argument) << invalid;
+    }
+    // URL characters only through the URL decoder
+    EXPECT_THROW(decode("EQA_qoVW"), std::invalid_argument);
+
+    // an invalid character deep inside a long string, past the vectorized blocks
+    auto encoded = encode(Data(120, 0xab));
+    encoded[100] = '*';
+    EXPECT_THROW(decode(encoded), std::invalid_argument);
+    encoded[100] = '\x80';
+    EXPECT_THROW(decodeBase64Url(encoded), std::invalid_argument);
+    encoded[100] = '=';
+    EXPECT_THROW(decode(encoded), std::invalid_argument);
+}
+
+TEST(Base64, DecodeUrlLong) {
+    Data data;
+    for (int i = 0; i < 96; ++i) {
+        data.push_back(static_cast<byte>(0xfb + i * 7));
+    }
+    const auto url = encodeBase64Url(data);
+    EXPECT_NE(url.find_first_of("-_"), std::string::npos);
+    EXPECT_EQ(hex(decodeBase64Url(url)), hex(data));
+    EXPECT_EQ(hex(decodeBase64Url(encode(data))), hex(data));
+}
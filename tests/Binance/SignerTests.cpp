@@ -10,7 +10,9 @@
 #include "Coin.h"
 #include "Ethereum/Address.h"
 #include "HDWallet.h"
+#include "Hash.h"
 #include "HexCoding.h"
+#include "PrivateKey.h"
 #include "proto/Binance.pb.h"
 
 #include <gtest/gtest.h>
@@ -206,6 +208,76 @@ TEST(BinanceSigner, BuildSend2) {
     );
 }
 
+TEST(BinanceSigner, BuildSendManyInputsOutputs) {
+    auto signingInput = Proto::SigningInput();
+    signingInput.set_chain_id("Binance-Chain-Tigris");
+    signingInput.set_account_number(19);
+    signingInput.set_sequence(23);
+    signingInput.set_memo("multi-send with many inputs and outputs");
+    signingInput.set_source(-2);
+
+    const auto privateKey = parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832");
+    signingInput.set_private_key(privateKey.data(), privateKey.size());
+
+    auto& order = *signingInput.mutable_send_order();
+    for (auto i = 0; i < 40; ++i) {
+        auto keyhash = Hash::sha256(Data{static_cast<uint8_t>(i)});
+        keyhash.resize(20);
+
+        auto input = order.add_inputs();
+        input->set_address(keyhash.data(), keyhash.size());
+        auto inputCoin = input->add_coins();
+        inputCoin->set_denom("BNB");
+        inputCoin->set_amount(1'000'000 + i);
+
+        auto output = order.add_outputs();
+        output->set_address(keyhash.data(), keyhash.size());
+        auto outputCoin = output->add_coins();
+        outputCoin->set_denom(i % 2 == 0 ? "BNB" : "BUSD-BD1");
+        outputCoin->set_amount(1'000'000 + i);
+    }
+
+    const auto signer = Signer(signingInput);
+    const auto signature = signer.sign();
+    const auto result = signer.build();
+
+    // Reference encoding: Transaction message with every field serialized separately, then amino-wrapped
+    auto orderData = Data{0x2A, 0x2C, 0x87, 0xFA};
+    const auto orderBytes = order.SerializeAsString();
+    append(orderData, Data(orderBytes.begin(), orderBytes.end()));
+
+    const auto publicKey = PrivateKey(privateKey).getPublicKey(TWPublicKeyTypeSECP256k1);
+    auto encodedPublicKey = Data{0xEB, 0x5A, 0xE9, 0x87, static_cast<uint8_t>(publicKey.bytes.size())};
+    append(encodedPublicKey, publicKey.bytes);
+    auto signatureObject = Proto::Signature();
+    signatureObject.set_pub_key(encodedPublicKey.data(), encodedPublicKey.size());
+    signatureObject.set_signature(signature.data(), signature.size());
+    signatureObject.set_account_number(19);
+    signatureObject.set_sequence(23);
+    const auto signatureBytes = signatureObject.SerializeAsString();
+
+    auto transaction = Proto::Transaction();
+    transaction.add_msgs(orderData.data(), orderData.size());
+    transaction.add_signatures(signatureBytes);
+    transaction.set_memo(signingInput.memo());
+    transaction.set_source(signingInput.source());
+    const auto transactionBytes = transaction.SerializeAsString();
+
+    auto expected = Data();
+    for (auto size = transactionBytes.size() + 4; ; size >>= 7) {
+        if (size < 0x80) {
+            expected.push_back(static_cast<uint8_t>(size));
+            break;
+        }
+        expected.push_back(static_cast<uint8_t>(size | 0x80));
+    }
+    append(expected, Data{0xF0, 0x62, 0x5D, 0xEE});
+    append(expected, Data(transactionBytes.begin(), transactionBytes.end()));
+
+    EXPECT_EQ(result.size(), 3077);
+    EXPECT_EQ(hex(result), hex(expected));
+}
+
 TEST(BinanceSigner, BuildHTLT) {
     const auto fromPrivateKey =
         PrivateKey(parse_hex("eeba3f6f2db26ced519a3d4c43afff101db957a21d54d25dc7fd235c404d7a5d"));
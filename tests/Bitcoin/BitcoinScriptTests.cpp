@@ -302,6 +302,86 @@ TEST(BitcoinScript, MatchMultiSig) {
     EXPECT_EQ(hex(keys[2]), "03c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432");
 }
 
+TEST(BitcoinScript, Classify) {
+    auto result = PayToScriptHash.classify();
+    EXPECT_EQ(result.type, ScriptType::payToScriptHash);
+    EXPECT_EQ(hex(result.data.toData()), "4733f37cf4db86fbc2efed2500b4f4e49f312023");
+
+    result = PayToWitnessScriptHash.classify();
+    EXPECT_EQ(result.type, ScriptType::payToWitnessScriptHash);
+    EXPECT_EQ(hex(result.data.toData()), "ff25429251b5a84f452230a3c75fd886b7fc5a7865ce4a7bb7a9d7c5be6da3db");
+
+    result = PayToWitnessPublicKeyHash.classify();
+    EXPECT_EQ(result.type, ScriptType::payToWitnessPublicKeyHash);
+    EXPECT_EQ(hex(result.data.toData()), "79091972186c449eb1ded22b78e40d009bdf0089");
+
+    result = PayToPublicKeyHash.classify();
+    EXPECT_EQ(result.type, ScriptType::payToPublicKeyHash);
+    EXPECT_EQ(hex(result.data.toData()), "79091972186c449eb1ded22b78e40d009bdf0089");
+
+    result = PayToPublicKeySecp256k1.classify();
+    EXPECT_EQ(result.type, ScriptType::payToPublicKey);
+    EXPECT_EQ(hex(result.data.toData()), "03c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432");
+
+    // unlike matchPayToPublicKey, the whole extended key is returned
+    result = PayToPublicKeySecp256k1Extended.classify();
+    EXPECT_EQ(result.type, ScriptType::payToPublicKey);
+    EXPECT_EQ(hex(result.data.toData()), "0499c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c166b489a4b7c491e7688e6ebea3a71fc3a1a48d60f98d5ce84c93b65e423fde91");
+
+    // taproot
+    const auto taproot = Script(parse_hex("5120" "a60869f0dbcf1dc659c9cecbaf8050135ea9e8cdc487053f1dc6880949dc684c"));
+    result = taproot.classify();
+    EXPECT_EQ(result.type, ScriptType::witnessProgram);
+    EXPECT_EQ(hex(result.data.toData()), "a60869f0dbcf1dc659c9cecbaf8050135ea9e8cdc487053f1dc6880949dc684c");
+
+    const auto multisig = Script(parse_hex("52"
+        "21" "03c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432"
+        "4c" "21" "0399c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c1"
+        "52" "ae"));
+    result = multisig.classify();
+    EXPECT_EQ(result.type, ScriptType::multisig);
+    EXPECT_TRUE(result.data.empty());
+    EXPECT_EQ(result.required, 2);
+    ASSERT_EQ(result.keyCount, 2);
+    EXPECT_EQ(hex(result.keys[0].toData()), "03c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432");
+    EXPECT_EQ(hex(result.keys[1].toData()), "0399c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c1");
+
+    // the views point into the script
+    result = PayToPublicKeyHash.classify();
+    EXPECT_EQ(result.data.data, PayToPublicKeyHash.bytes.data() + 3);
+
+    for (const auto& hexScript : {"", "ae", "51ae", "6a04deadbeef", "a9144733f37cf4db86fbc2efed2500b4f4e49f31202387ac", "0014" "79091972186c449eb1ded22b78e40d009bdf00",
+                                  "51" "21" "03c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432" "52" "ae"}) {
+        result = Script(parse_hex(hexScript)).classify();
+        EXPECT_EQ(result.type, ScriptType::nonStandard) << hexScript;
+        EXPECT_EQ(result.keyCount, 0) << hexScript;
+        EXPECT_EQ(result.required, 0) << hexScript;
+    }
+}
+
+TEST(BitcoinScript, ClassifyMultisigKeyLimit) {
+    const auto key = std::string("21" "03c9f4836b9a4f77fc0d81f7bcb01b7f1b35916864b9476c241ce9fc198bd25432");
+    std::string sixteen;
+    for (int i = 0; i < 16; ++i) {
+        sixteen += key;
+    }
+
+    auto result = Script(parse_hex("51" + sixteen + "60" "ae")).classify();
+    EXPECT_EQ(result.type, ScriptType::multisig);
+    EXPECT_EQ(result.required, 1);
+    EXPECT_EQ(result.keyCount, 16);
+
+    // a 17th key can't be counted by a small integer opcode
+    result = Script(parse_hex("51" + sixteen + key + "60" "ae")).classify();
+    EXPECT_EQ(result.type, ScriptType::nonStandard);
+    EXPECT_EQ(result.keyCount, 0);
+
+    std::vector<Data> keys;
+    int required;
+    EXPECT_FALSE(Script(parse_hex("51" + sixteen + key + "60" "ae")).matchMultisig(keys, required));
+    EXPECT_TRUE(keys.empty());
+}
+
 TEST(BitcoinTransactionSigner, PushAllEmpty) {
     {
         std::vector<Data> input = {};
@@ -1411,3 +1411,52 @@ TEST(BitcoinSigning, RedeemExtendedPubkeyUTXO) {
     signedTx.encode(encoded);
     EXPECT_EQ(encoded.size(), 402);
 }
+
+TEST(BitcoinSigning, RedeemExtendedPubkeyP2PK) {
+    auto wif = "L4BeKzm3AHDUMkxLRVKTSVxkp6Hz9FcMQPh18YCKU1uioXfovzwP";
+    auto decoded = Base58::bitcoin.decodeCheck(wif);
+    auto key = PrivateKey(Data(decoded.begin() + 1, decoded.begin() + 33));
+    auto pubkey = key.getPublicKey(TWPublicKeyTypeSECP256k1Extended);
+    ASSERT_EQ(pubkey.bytes.size(), 65);
+
+    // The key is looked up by the hash of all 65 bytes, the same hash as its uncompressed P2PKH address
+    auto utxo0Script = Script::buildPayToPublicKey(pubkey.bytes);
+    const auto match = utxo0Script.classify();
+    ASSERT_EQ(match.type, ScriptType::payToPublicKey);
+    EXPECT_EQ(hex(Hash::sha256ripemd(match.data.data, match.data.size)), hex(Hash::sha256ripemd(pubkey.bytes.data(), pubkey.bytes.size())));
+
+    SigningInput input;
+    input.coinType = TWCoinTypeBitcoin;
+    input.hashType = hashTypeForCoin(TWCoinTypeBitcoin);
+    input.amount = 16000;
+    input.useMaxAmount = true;
+    input.byteFee = 1;
+    input.toAddress = "1PAmpW5igXUJnuuzRa5yTcsWHwBamZG7Y2";
+
+    UTXO utxo0;
+    utxo0.script = utxo0Script;
+    utxo0.amount = 16874;
+    auto hash0 = parse_hex("6ae3f1d245521b0ea7627231d27d613d58c237d6bf97a1471341a3532e31906c");
+    std::reverse(hash0.begin(), hash0.end());
+    utxo0.outPoint = OutPoint(hash0, 0, UINT32_MAX);
+    input.utxos.push_back(utxo0);
+
+    input.privateKeys.push_back(key);
+
+    auto result = TransactionSigner<Transaction, TransactionBuilder>::sign(input);
+    ASSERT_TRUE(result) << std::to_string(result.error());
+    auto signedTx = result.payload();
+    ASSERT_EQ(signedTx.inputs.size(), 1);
+
+    // P2PK: the script is a single signature push, no public key
+    const auto& scriptSig = signedTx.inputs[0].script.bytes;
+    ASSERT_GT(scriptSig.size(), 1);
+    EXPECT_EQ(scriptSig[0] + 1u, scriptSig.size());
+    EXPECT_EQ(scriptSig.back(), TWBitcoinSigHashTypeAll);
+
+    // Without the key, the input can't be signed
+    input.privateKeys = {PrivateKey(parse_hex("bbc27228ddcb9209d7fd6f36b02f7dfa6252af40bb2f1cbc7a557da8027ff866"))};
+    const auto missingKey = TransactionSigner<Transaction, TransactionBuilder>::sign(input);
+    ASSERT_FALSE(missingKey);
+    EXPECT_EQ(missingKey.error(), Common::Proto::Error_missing_private_key);
+}
@@ -36,6 +36,44 @@ TEST(BitcoinTransaction, Encode) {
     Data unsignedData;
     transaction.encode(unsignedData, Transaction::SegwitFormatMode::NonSegwit);
     ASSERT_EQ(unsignedData.size(), 201);
+    EXPECT_EQ(transaction.size(Transaction::SegwitFormatMode::NonSegwit), 201);
     ASSERT_EQ(hex(unsignedData),
         "02000000035897de6bd6027a475eadd57019d4e6872c396d0716c4875a5f1a6fcfdf385c1f0000000000ffffffffbf829c6bcf84579331337659d31f89dfd138f7f7785802d5501c92333145ca7c1200000000ffffffff22a6f904655d53ae2ff70e701a0bbd90aa3975c0f40bfc6cc996a9049e31cdfc0100000000ffffffff0280a81201000000001976a9141fc11f39be1729bf973a7ab6a615ca4729d6457488ac0084d717000000001976a914f2d4db28cad6502226ee484ae24505c2885cb12d88ac00000000");
 }
+
+TEST(BitcoinTransaction, SizeMatchesEncoding) {
+    auto transaction = Transaction(1, 0x11223344);
+    // more than 252 inputs and a script over 252 bytes need multi-byte length prefixes
+    for (uint32_t i = 0; i < 300; ++i) {
+        auto outPoint = OutPoint(Data(32, static_cast<TW::byte>(i)), i);
+        transaction.inputs.emplace_back(outPoint, Script(Data(i % 3 == 0 ? 0 : 107, 0x51)), 0xfffffffe);
+    }
+    transaction.inputs[7].script = Script(Data(300, 0x52));
+    transaction.outputs.emplace_back(1000, Script(parse_hex("0014f2d4db28cad6502226ee484ae24505c2885cb12d")));
+    transaction.outputs.emplace_back(2000, Script(Data(70000, 0x6a)));
+
+    const auto check = [&transaction]() {
+        for (auto mode : {Transaction::NonSegwit, Transaction::IfHasWitness, Transaction::Segwit}) {
+            Data data = parse_hex("abcd");
+            transaction.encode(data, mode);
+            EXPECT_EQ(data.size(), 2 + transaction.size(mode)) << mode;
+        }
+        Data witness;
+        transaction.encodeWitness(witness);
+        EXPECT_EQ(witness.size(), transaction.witnessSize());
+        Data encoded;
+        transaction.encode(encoded);
+        EXPECT_EQ(encoded.size(), transaction.size());
+    };
+
+    check();
+    EXPECT_EQ(transaction.size(Transaction::NonSegwit), transaction.size(Transaction::IfHasWitness));
+
+    transaction.inputs[1].scriptWitness = {Data(72, 1), Data(33, 2)};
+    transaction.inputs[2].scriptWitness = {Data(), Data(260, 3)};
+    check();
+    EXPECT_EQ(transaction.size(Transaction::Segwit), transaction.size(Transaction::NonSegwit) + 2 + transaction.witnessSize());
+    EXPECT_EQ(transaction.inputs[1].witnessSize(), 1 + 1 + 72 + 1 + 33);
+    EXPECT_EQ(transaction.inputs[7].size(), 36 + 3 + 300 + 4);
+    EXPECT_EQ(transaction.outputs[1].size(), 8 + 5 + 70000);
+}
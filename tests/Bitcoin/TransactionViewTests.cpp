@@ -0,0 +1,237 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Bitcoin/TransactionView.h"
+#include "Bitcoin/OpCodes.h"
+#include "Decred/Transaction.h"
+#include "Zcash/Transaction.h"
+#include "BinaryCoding.h"
+#include "Hash.h"
+#include "HexCoding.h"
+#include "PrivateKey.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace TW;
+using namespace TW::Bitcoin;
+
+namespace {
+
+Data reversed(Data data) {
+    std::reverse(data.begin(), data.end());
+    return data;
+}
+
+/// One input, and one empty-script output per value.
+Data rawWithOutputs(const std::vector<int64_t>& values) {
+    Data raw = parse_hex("0100000001" + std::string(64, '0') + "ffffffff00ffffffff");
+    raw.push_back(static_cast<byte>(values.size()));
+    for (auto value : values) {
+        encode64LE(static_cast<uint64_t>(value), raw);
+        raw.push_back(0);
+    }
+    encode32LE(0, raw);
+    return raw;
+}
+
+} // namespace
+
+TEST(BitcoinTransactionView, GenesisCoinbase) {
+    const auto raw = parse_hex("01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff4d04ffff001d0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e206272696e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000");
+
+    const auto tx = TransactionView::parse(raw);
+    ASSERT_TRUE(tx.has_value());
+    EXPECT_EQ(tx->version, 1);
+    EXPECT_EQ(tx->lockTime, 0);
+    EXPECT_FALSE(tx->hasWitness());
+    ASSERT_EQ(tx->inputs.size(), 1);
+    EXPECT_EQ(hex(tx->inputs[0].previousHash.toData()), std::string(64, '0'));
+    EXPECT_EQ(tx->inputs[0].previousIndex, 0xffffffff);
+    EXPECT_EQ(tx->inputs[0].script.size, 77);
+    // the script is referenced in place, not copied
+    EXPECT_EQ(tx->inputs[0].script.data, raw.data() + 4 + 1 + 36 + 1);
+    ASSERT_EQ(tx->outputs.size(), 1);
+    EXPECT_EQ(tx->outputs[0].value, 5000000000);
+    EXPECT_EQ(tx->outputValue(), std::optional<int64_t>(5000000000));
+    EXPECT_EQ(tx->outputs[0].script.size, 67);
+
+    EXPECT_EQ(hex(reversed(tx->hash())), "4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+    EXPECT_EQ(tx->witnessHash(), tx->hash());
+
+    Data encoded;
+    tx->transaction().encode(encoded);
+    EXPECT_EQ(encoded, raw);
+}
+
+TEST(BitcoinTransactionView, Segwit) {
+    // signed BIP143 native P2WPKH example, see BitcoinSigning.SignP2WPKH_Bip143
+    const auto raw = parse_hex("01000000000102fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f00000000494830450221008b9d1dc26ba6a9cb62127b02742fa9d754cd3bebf337f7a55d114c8e5cdd30be022040529b194ba3f9281a99f2b1c0a19c0489bc22ede944ccf4ecbab4cc618ef3ed01eeffffffef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42dbee7e4dbe6a21b2d50ce2f0167faa815988ac000247304402203609e17b84f6a7d30c80bfa610b5b4542f32a8a0d5447a12fb1366d7f01cc44a0220573a954c4518331561406f90300e8f3358f51928d43c212a8caed02de67eebee0121025476c2e83188368da1ff3e292e7acafcdb3566bb0ad253f62fc70f07aeee635711000000");
+
+    const auto tx = TransactionView::parse(raw);
+    ASSERT_TRUE(tx.has_value());
+    EXPECT_TRUE(tx->hasWitness());
+    EXPECT_EQ(tx->lockTime, 0x11);
+    ASSERT_EQ(tx->inputs.size(), 2);
+    EXPECT_EQ(tx->inputs[0].script.size, 0x49);
+    EXPECT_TRUE(tx->inputs[0].witness.empty());
+    EXPECT_EQ(tx->inputs[0].sequence, 0xffffffee);
+    EXPECT_TRUE(tx->inputs[1].script.empty());
+    ASSERT_EQ(tx->inputs[1].witness.size(), 2);
+    EXPECT_EQ(tx->inputs[1].witness[0].size, 0x47);
+    EXPECT_EQ(hex(tx->inputs[1].witness[1].toData()), "025476c2e83188368da1ff3e292e7acafcdb3566bb0ad253f62fc70f07aeee6357");
+    ASSERT_EQ(tx->outputs.size(), 2);
+    EXPECT_EQ(tx->outputs[0].value, 112340000);
+    EXPECT_EQ(tx->outputs[1].value, 223450000);
+
+    const auto transaction = tx->transaction();
+    Data encoded;
+    transaction.encode(encoded);
+    EXPECT_EQ(encoded, raw);
+
+    Data nonSegwit;
+    transaction.encode(nonSegwit, Transaction::NonSegwit);
+    EXPECT_EQ(hex(tx->hash()), hex(Hash::sha256d(nonSegwit.data(), nonSegwit.size())));
+    EXPECT_EQ(hex(tx->witnessHash()), hex(Hash::sha256d(raw.data(), raw.size())));
+
+    const auto nonSegwitTx = TransactionView::parse(nonSegwit);
+    ASSERT_TRUE(nonSegwitTx.has_value());
+    EXPECT_FALSE(nonSegwitTx->hasWitness());
+    EXPECT_EQ(nonSegwitTx->hash(), tx->hash());
+}
+
+TEST(BitcoinTransactionView, ZcashSapling) {
+    // based on ZIP-243 test vector 3, see TWZcashTransaction.Encode
+    auto transaction = Zcash::Transaction();
+    transaction.lockTime = 0x0004b029;
+    transaction.expiryHeight = 0x0004b048;
+    transaction.inputs.emplace_back(OutPoint(parse_hex("a8c685478265f4c14dada651969c45a65e1aeb8cd6791f2f5bb6a1d9952104d9"), 1), Script(parse_hex("0014")), 0xfffffffe);
+    transaction.outputs.emplace_back(0x02625a00, Script(parse_hex("76a9148132712c3ff19f3a151234616777420a6d7ef22688ac")));
+    transaction.outputs.emplace_back(0x0098958b, Script(parse_hex("76a9145453e4698f02a38abdaa521cd1ff2dee6fac187188ac")));
+    Data raw;
+    transaction.encode(raw);
+
+    const auto tx = TransactionView::parse(raw, TransactionView::ZcashSapling);
+    ASSERT_TRUE(tx.has_value());
+    EXPECT_EQ(static_cast<uint32_t>(tx->version), 0x80000004);
+    EXPECT_EQ(tx->lockTime, 0x0004b029);
+    EXPECT_EQ(tx->expiryHeight, 0x0004b048);
+    EXPECT_EQ(tx->valueBalance, 0);
+    ASSERT_EQ(tx->inputs.size(), 1);
+    EXPECT_EQ(tx->inputs[0].previousIndex, 1);
+    EXPECT_EQ(tx->inputs[0].sequence, 0xfffffffe);
+    EXPECT_EQ(tx->outputValue(), std::optional<int64_t>(0x02625a00 + 0x0098958b));
+    EXPECT_EQ(tx->hash(), Hash::sha256d(raw.data(), raw.size()));
+    EXPECT_EQ(tx->witnessHash(), tx->hash());
+
+    // the same transaction is not valid Bitcoin framing
+    EXPECT_FALSE(TransactionView::parse(raw).has_value());
+
+    // one shielded spend, which needs a binding signature
+    auto shielded = Data(raw.begin(), raw.end() - 3);
+    append(shielded, 0x01);
+    append(shielded, Data(384, 0xab));
+    append(shielded, parse_hex("0000"));
+    EXPECT_FALSE(TransactionView::parse(shielded, TransactionView::ZcashSapling).has_value());
+    append(shielded, Data(64, 0xcd));
+    const auto shieldedTx = TransactionView::parse(shielded, TransactionView::ZcashSapling);
+    ASSERT_TRUE(shieldedTx.has_value());
+    EXPECT_EQ(shieldedTx->outputs.size(), 2);
+}
+
+TEST(BitcoinTransactionView, Decred) {
+    const auto privateKey = PrivateKey(parse_hex("22a47fa09a223f2aa079edf85a7c2d4f8720ee63e502ee2869afab7de234b80c"));
+    const auto keyhash = Hash::ripemd(Hash::blake256(privateKey.getPublicKey(TWPublicKeyTypeSECP256k1).bytes));
+
+    // origin transaction of DecredSigner.SignP2PKH
+    auto originTx = Decred::Transaction();
+    auto txInOrigin = Decred::TransactionInput();
+    txInOrigin.previousOutput = Decred::OutPoint(std::array<byte, 32>{}, UINT32_MAX, 0);
+    txInOrigin.valueIn = 100'000'000;
+    txInOrigin.script = Script(Data{OP_0, OP_0});
+    originTx.inputs.push_back(txInOrigin);
+    auto txOutOrigin = Decred::TransactionOutput();
+    txOutOrigin.value = 100'000'000;
+    txOutOrigin.script = Script::buildPayToPublicKeyHash(keyhash);
+    originTx.outputs.push_back(txOutOrigin);
+    Data raw;
+    originTx.encode(raw);
+
+    const auto tx = TransactionView::parse(raw, TransactionView::Decred);
+    ASSERT_TRUE(tx.has_value());
+    EXPECT_EQ(tx->version, 1);
+    ASSERT_EQ(tx->inputs.size(), 1);
+    EXPECT_EQ(tx->inputs[0].previousIndex, UINT32_MAX);
+    EXPECT_EQ(tx->inputs[0].valueIn, 100'000'000);
+    EXPECT_EQ(hex(tx->inputs[0].script.toData()), "0000");
+    ASSERT_EQ(tx->outputs.size(), 1);
+    EXPECT_EQ(tx->outputs[0].value, 100'000'000);
+    EXPECT_EQ(tx->outputs[0].script.toData(), Script::buildPayToPublicKeyHash(keyhash).bytes);
+    EXPECT_EQ(hex(tx->hash()), "0ff6ff7c6774a56ccc51598b11724c9c441cadc52978ddb5f08f3511a0cc777a");
+    EXPECT_NE(tx->witnessHash(), tx->hash());
+
+    // signed transaction, see TWAnySignerDecred.Sign
+    const auto signedRaw = parse_hex("0100000001fdbfe9dd703f306794a467f175be5bd9748a7925033ea1cf9889d7cf4dd1155000000000000000000002809698000000000000001976a914989b1aecabf1c24e213cc0f2d8a22ffee25dd4e188ac40b6c6010000000000001976a9142a194fc92e27fef9cc2b057bc9060c580cbb484888ac000000000000000001000000000000000000000000ffffffff6a47304402206ee887c9239e5fff0048674bdfff2a8cfbeec6cd4a3ccebcc12fac44b24cc5ac0220718f7c760818fde18bc5ba8457d43d5a145cc4cf13d2a5557cba9107e9f4558d0121026cc34b92cefb3a4537b3edb0b6044c04af27c01583c577823ecc69a9a21119b6");
+    const auto signedTx = TransactionView::parse(signedRaw, TransactionView::Decred);
+    ASSERT_TRUE(signedTx.has_value());
+    EXPECT_EQ(signedTx->outputs.size(), 2);
+    EXPECT_EQ(signedTx->outputValue(), std::optional<int64_t>(10000000 + 29800000));
+    EXPECT_EQ(signedTx->inputs[0].script.size, 0x6a);
+}
+
+TEST(BitcoinTransactionView, OutputValueRange) {
+    const auto maxMoney = TransactionView::maxMoney;
+    const auto maxValue = std::numeric_limits<int64_t>::max();
+    const auto valueOf = [](const std::vector<int64_t>& values, int64_t limit = TransactionView::maxMoney) {
+        const auto tx = TransactionView::parse(rawWithOutputs(values));
+        EXPECT_TRUE(tx.has_value());
+        return tx.has_value() ? tx->outputValue(limit) : std::nullopt;
+    };
+
+    EXPECT_EQ(valueOf({}), std::optional<int64_t>(0));
+    EXPECT_EQ(valueOf({maxMoney}), std::optional<int64_t>(maxMoney));
+    EXPECT_EQ(valueOf({maxMoney - 1, 1}), std::optional<int64_t>(maxMoney));
+    EXPECT_EQ(valueOf({maxMoney, 1}), std::nullopt);
+    EXPECT_EQ(valueOf({maxMoney + 1}), std::nullopt);
+    EXPECT_EQ(valueOf({-1}), std::nullopt);
+    EXPECT_EQ(valueOf({1, -1}), std::nullopt);
+    // a plain int64 sum of these would overflow
+    EXPECT_EQ(valueOf({maxValue, maxValue}), std::nullopt);
+    EXPECT_EQ(valueOf({maxValue, 1}, maxValue), std::nullopt);
+    EXPECT_EQ(valueOf({std::numeric_limits<int64_t>::min(), -1}, maxValue), std::nullopt);
+
+    // coins with a larger supply pass their own limit
+    EXPECT_EQ(valueOf({maxMoney, 1}, maxValue), std::optional<int64_t>(maxMoney + 1));
+    EXPECT_EQ(valueOf({maxValue - 1, 1}, maxValue), std::optional<int64_t>(maxValue));
+}
+
+TEST(BitcoinTransactionView, Invalid) {
+    const auto raw = parse_hex("01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff0100ffffffff0100f2052a010000000000000000");
+    ASSERT_TRUE(TransactionView::parse(raw).has_value());
+
+    // every truncation fails
+    for (size_t size = 0; size < raw.size(); ++size) {
+        EXPECT_FALSE(TransactionView::parse(raw.data(), size).has_value()) << size;
+    }
+    // trailing data
+    auto longer = raw;
+    longer.push_back(0);
+    EXPECT_FALSE(TransactionView::parse(longer).has_value());
+    // input count far larger than the data
+    auto manyInputs = raw;
+    manyInputs[4] = 0xfe;
+    EXPECT_FALSE(TransactionView::parse(manyInputs).has_value());
+    // unknown segwit flag
+    EXPECT_FALSE(TransactionView::parse(parse_hex("010000000002")).has_value());
+    // segwit marker without any witness data
+    auto noWitness = parse_hex("01000000" "0001" "01");
+    append(noWitness, Data(32 + 4, 0));
+    append(noWitness, parse_hex("00" "ffffffff" "00" "00" "00000000"));
+    EXPECT_FALSE(TransactionView::parse(noWitness).has_value());
+    // Decred witness-only serialization is not supported
+    EXPECT_FALSE(TransactionView::parse(parse_hex("01000200"), TransactionView::Decred).has_value());
+}
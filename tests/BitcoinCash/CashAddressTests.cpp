@@ -0,0 +1,119 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Bitcoin/CashAddress.h"
+#include "HexCoding.h"
+#include "PublicKey.h"
+
+#include <TrezorCrypto/cash_addr.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+
+using namespace TW;
+using namespace TW::Bitcoin;
+
+namespace {
+
+/// Validation through the trezor-crypto codec.
+bool referenceIsValid(const std::string& string) {
+    const std::string prefix = "bitcoincash:";
+    const auto withPrefix = string.compare(0, prefix.size(), prefix) == 0 ? string : prefix + string;
+    char hrp[21] = {0};
+    uint8_t data[104];
+    size_t dataLen = 0;
+    return cash_decode(hrp, data, &dataLen, withPrefix.c_str()) != 0 && dataLen == CashAddress::size &&
+           std::strcmp(hrp, "bitcoincash") == 0;
+}
+
+std::string referenceEncode(const CashAddress::Payload& payload) {
+    char output[129];
+    EXPECT_EQ(cash_addr_encode(output, "bitcoincash", payload.data(), payload.size()), 1);
+    return output;
+}
+
+} // namespace
+
+TEST(BitcoinCashAddress, Valid) {
+    EXPECT_TRUE(CashAddress::isValid(std::string("bitcoincash:qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y4")));
+    EXPECT_TRUE(CashAddress::isValid(std::string("qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y4")));
+    EXPECT_TRUE(CashAddress::isValid(std::string("pqx578nanz2h2estzmkr53zqdg6qt8xyqvwhn6qeyc")));
+
+    // bad checksum
+    EXPECT_FALSE(CashAddress::isValid(std::string("bitcoincash:qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y5")));
+    // upper and mixed case
+    EXPECT_FALSE(CashAddress::isValid(std::string("BITCOINCASH:QQA2QX0D8TEGW32XK8U75WS055EN4X3H2U0E6K46Y4")));
+    EXPECT_FALSE(CashAddress::isValid(std::string("QQA2QX0D8TEGW32XK8U75WS055EN4X3H2U0E6K46Y4")));
+    // other prefix, missing separator, wrong length
+    EXPECT_FALSE(CashAddress::isValid(std::string("bchtest:qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y4")));
+    EXPECT_FALSE(CashAddress::isValid(std::string("bitcoincashqqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y4")));
+    EXPECT_FALSE(CashAddress::isValid(std::string("qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y")));
+    EXPECT_FALSE(CashAddress::isValid(std::string("bitcoincash:")));
+    EXPECT_FALSE(CashAddress::isValid(std::string("bitcoin")));
+    EXPECT_FALSE(CashAddress::isValid(std::string("")));
+    // a character outside the charset
+    EXPECT_FALSE(CashAddress::isValid(std::string("bitcoincash:qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46yb")));
+}
+
+TEST(BitcoinCashAddress, Validate) {
+    const auto result = CashAddress::validate({
+        "bitcoincash:qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y4",
+        "bitcoincash:qqa2qx0d8tegw32xk8u75ws055en4x3h2u0e6k46y5",
+        "pqx578nanz2h2estzmkr53zqdg6qt8xyqvwhn6qeyc",
+        "",
+    });
+    EXPECT_EQ(result, (std::vector<bool>{true, false, true, false}));
+    EXPECT_TRUE(CashAddress::validate({}).empty());
+}
+
+TEST(BitcoinCashAddress, DecodeEncode) {
+    const auto payload = CashAddress::decode("bitcoincash:qpk05r5kcd8uuzwqunn8rlx5xvuvzjqju5rch3tc0u");
+    ASSERT_TRUE(payload.has_value());
+    EXPECT_EQ(hex(*payload), "006cfa0e96c34fce09c0e4e671fcd43338c14812e5");
+    EXPECT_EQ(CashAddress::encode(*payload), "bitcoincash:qpk05r5kcd8uuzwqunn8rlx5xvuvzjqju5rch3tc0u");
+    EXPECT_FALSE(CashAddress::decode("bitcoincash:qpk05r5kcd8uuzwqunn8rlx5xvuvzjqju5rch3tc0v").has_value());
+
+    const auto address = CashAddress("pzukqjmcyzrkh3gsqzdcy3e3d39cqxhl3g0f405k5l");
+    EXPECT_EQ(address.string(), "bitcoincash:pzukqjmcyzrkh3gsqzdcy3e3d39cqxhl3g0f405k5l");
+    EXPECT_EQ(hex(address.payload()), "08b9604b7820876bc510009b8247316c4b801aff8a");
+
+    EXPECT_EQ(CashAddress("bitcoincash:qpk05r5kcd8uuzwqunn8rlx5xvuvzjqju5rch3tc0u").legacyAddress().string(), "1AwDXywmyhASpCCFWkqhySgZf8KiswFoGh");
+    EXPECT_EQ(CashAddress("qruxj7zq6yzpdx8dld0e9hfvt7u47zrw9gfr5hy0vh").legacyAddress().string(), "1PeUvjuxyf31aJKX6kCXuaqxhmG78ZUdL1");
+}
+
+TEST(BitcoinCashAddress, FromPublicKey) {
+    const auto publicKey = PublicKey(parse_hex("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"), TWPublicKeyTypeSECP256k1);
+    const auto address = CashAddress(publicKey);
+    EXPECT_EQ(hex(address.payload()), "00751e76e8199196d454941c45d1b3a323f1433bd6");
+    EXPECT_EQ(address.string(), referenceEncode(address.payload()));
+}
+
+TEST(BitcoinCashAddress, MatchesReferenceCodec) {
+    std::mt19937 rng(88);
+    for (int i = 0; i < 500; ++i) {
+        CashAddress::Payload payload;
+        for (auto& byte : payload) {
+            byte = static_cast<TW::byte>(rng());
+        }
+        payload[0] = (i % 2) ? 0x08 : 0x00;
+
+        const auto string = CashAddress::encode(payload);
+        ASSERT_EQ(string, referenceEncode(payload));
+        const auto decoded = CashAddress::decode(string);
+        ASSERT_TRUE(decoded.has_value());
+        EXPECT_EQ(*decoded, payload);
+
+        // single character substitutions and truncations
+        auto mutated = string;
+        mutated[12 + rng() % (mutated.size() - 12)] = "qpzry9x8gf2tvdw0s3jn54khce6mua7lQP1bio:"[rng() % 39];
+        EXPECT_EQ(CashAddress::isValid(mutated), referenceIsValid(mutated)) << mutated;
+        const auto truncated = string.substr(0, string.size() - 1 - rng() % 5);
+        EXPECT_EQ(CashAddress::isValid(truncated), referenceIsValid(truncated)) << truncated;
+        EXPECT_TRUE(CashAddress::isValid(string.substr(12)));
+    }
+}
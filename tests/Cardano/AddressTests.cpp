@@ -6,6 +6,9 @@
 
 #include "Cardano/AddressV3.h"
 
+#include "Base58.h"
+#include "Cbor.h"
+#include "Crc.h"
 #include "HDWallet.h"
 #include "HexCoding.h"
 #include "PrivateKey.h"
@@ -177,6 +180,25 @@ TEST(CardanoAddress, MnemonicToAddressV2) {
     }
 }
 
+TEST(CardanoAddress, CreateRangeV3) {
+    auto mnemonic = "cost dash dress stove morning robust group affair stomach vacant route volume yellow salute laugh";
+    const auto wallet = HDWallet(mnemonic, "");
+    const auto addresses = AddressV3::createRange(wallet, DerivationPath("m/1852'/1815'/0'/0"), 0, 3);
+    ASSERT_EQ(addresses.size(), 3);
+    EXPECT_EQ("addr1sna05l45z33zpkm8z44q8f0h57wxvm0c86e34wlmua7gtcrdgrdrzy8ny3walyfjanhe33nsyuh088qr5gepqaen6jsa9r94xvvd7fh6jc3e6x", addresses[0].string());
+    EXPECT_EQ("addr1sjkw630aatyg273m9cpgezvs2unf6xrtw0z7udhguh7ednkhf9p0jduldrg5qsnaz99e3sl4f8t56w0hs0zhql9lacr63mx693ppjw2r5nwehs", addresses[1].string());
+    EXPECT_EQ("addr1sng939f9el5mnsj4l30kk2f02ea63rwhny5pa69masam4xtsmp5naq6lks0p7pzkn35z7juyd7hhk3zc8p9dc736pu4nzhyy6fusxapa9v5h5c", addresses[2].string());
+
+    // same keys one at a time, and from the cached root
+    const auto tail = AddressV3::createRange(wallet, DerivationPath("m/1852'/1815'/0'/0"), 2, 1);
+    ASSERT_EQ(tail.size(), 1);
+    EXPECT_EQ(addresses[2].string(), tail[0].string());
+    EXPECT_EQ("a018cd746e128a0be0782b228c275473205445c33b9000a33dd5668b430b5744", hex(wallet.getMasterKey(TWCurveED25519Extended).bytes));
+    EXPECT_EQ("26877cfe435fddda02409b839b7386f3738f10a30b95a225f4b720ee71d2505b", hex(wallet.getMasterKeyExtension(TWCurveED25519Extended).bytes));
+
+    EXPECT_TRUE(AddressV3::createRange(wallet, DerivationPath("m/1852'/1815'/0'/0"), 0, 0).empty());
+}
+
 TEST(CardanoAddress, KeyHashV2) {
     auto xpub = parse_hex("e6f04522f875c1563682ca876ddb04c2e2e3ae718e3ff9f11c03dd9f9dccf69869272d81c376382b8a87c21370a7ae9618df8da708d1a9490939ec54ebe43000");
     auto hash = AddressV2::keyHash(xpub);
@@ -328,6 +350,65 @@ TEST(CardanoAddress, FromStringNegativeBadChecksumV2) {
     FAIL() << "Expected exception!";
 }
 
+TEST(CardanoAddress, CborDataV2MatchesCborEncoder) {
+    for (const auto* string: {
+        "Ae2tdPwUPEZ18ZjTLnLVr9CEvUEUX4eW1LBHbxxxJgxdAYHrDeSCSbCxrvx",
+        "DdzFFzCqrhssmYoG5Eca1bKZFdGS8d6iag1mU4wbLeYcSPVvBNF2wRG8yhjzQqErbg63N6KJA4DHqha113tjKDpGEwS5x1dT2KfLSbSJ"
+    }) {
+        const auto address = AddressV2(string);
+        const auto payload = Cbor::Encode::array({
+            Cbor::Encode::bytes(address.root),
+            Cbor::Encode::fromRaw(address.attrs),
+            Cbor::Encode::uint(address.type),
+        }).encoded();
+        const auto expected = Cbor::Encode::array({
+            Cbor::Encode::tag(AddressV2::PayloadTag, Cbor::Encode::bytes(payload)),
+            Cbor::Encode::uint(Crc::crc32(payload)),
+        }).encoded();
+        EXPECT_EQ(hex(address.getCborData()), hex(expected));
+        EXPECT_EQ(address.string(), string);
+    }
+}
+
+TEST(CardanoAddress, ParseV2NonCanonicalLayout) {
+    // Same address, but the crc is encoded on 8 bytes; the fast path reads non-minimal headers as well
+    const auto address = AddressV2("Ae2tdPwUPEZ18ZjTLnLVr9CEvUEUX4eW1LBHbxxxJgxdAYHrDeSCSbCxrvx");
+    auto data = address.getCborData();
+    ASSERT_EQ(data[data.size() - 5], 0x1a);
+    data[data.size() - 5] = 0x1b;
+    data.insert(data.end() - 4, {0, 0, 0, 0});
+    const auto string = Base58::bitcoin.encode(data);
+
+    EXPECT_TRUE(AddressV2::isValid(string));
+    EXPECT_EQ(AddressV2(string), address);
+
+    // crc mismatch is rejected
+    data.back() ^= 1;
+    EXPECT_FALSE(AddressV2::isValid(Base58::bitcoin.encode(data)));
+}
+
+TEST(CardanoAddress, ParseV2IndefiniteLength) {
+    // Same address, with an indefinite-length outer array: not handled by the fast path, parsed by Cbor::Decode
+    const auto address = AddressV2("Ae2tdPwUPEZ18ZjTLnLVr9CEvUEUX4eW1LBHbxxxJgxdAYHrDeSCSbCxrvx");
+    auto data = address.getCborData();
+    ASSERT_EQ(data[0], 0x82);
+    data[0] = 0x9f;
+    data.push_back(0xff);
+    const auto string = Base58::bitcoin.encode(data);
+
+    EXPECT_TRUE(AddressV2::isValid(string));
+    const auto parsed = AddressV2(string);
+    EXPECT_EQ(parsed, address);
+    EXPECT_EQ(hex(parsed.root), hex(address.root));
+    EXPECT_EQ(hex(parsed.attrs), hex(address.attrs));
+    EXPECT_EQ(parsed.type, address.type);
+    EXPECT_EQ(parsed.string(), "Ae2tdPwUPEZ18ZjTLnLVr9CEvUEUX4eW1LBHbxxxJgxdAYHrDeSCSbCxrvx");
+
+    // crc mismatch is rejected by the fallback too
+    data[data.size() - 2] ^= 1;
+    EXPECT_FALSE(AddressV2::isValid(Base58::bitcoin.encode(data)));
+}
+
 TEST(CardanoAddress, DataV3) {
     // group addr
     auto address = AddressV3("addr1s3xuxwfetyfe7q9u3rfn6je9stlvcgmj8rezd87qjjegdtxm3y3f2mgtn87mrny9r77gm09h6ecslh3gmarrvrp9n4yzmdnecfxyu59jz29g8j");
@@ -10,6 +10,11 @@
 #include "proto/Cosmos.pb.h"
 #include "Cosmos/Address.h"
 #include "Cosmos/Signer.h"
+#include "Cosmos/ProtobufSerialization.h"
+#include "Cosmos/Protobuf/bank_tx.pb.h"
+#include "Cosmos/Protobuf/staking_tx.pb.h"
+#include "Cosmos/Protobuf/tx.pb.h"
+#include "PrivateKey.h"
 
 #include <gtest/gtest.h>
 #include <google/protobuf/util/json_util.h>
@@ -49,7 +54,7 @@ TEST(CosmosSigner, SignTx) {
     auto privateKey = parse_hex("80e81ea269e66a0a05b11236df7919fb7fbeedba87452d667489d7403a02f005");
     input.set_private_key(privateKey.data(), privateKey.size());
 
-    auto output = Signer::sign(input);
+    auto output = Signer::sign(input, TWCoinTypeCosmos);
 
     ASSERT_EQ(R"({"mode":"block","tx":{"fee":{"amount":[{"amount":"200","denom":"muon"}],"gas":"200000"},"memo":"","msg":[{"type":"cosmos-sdk/MsgSend","value":{"amount":[{"amount":"1","denom":"muon"}],"from_address":"cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02","to_address":"cosmos1zt50azupanqlfam5afhv3hexwyutnukeh4c573"}}],"signatures":[{"pub_key":{"type":"tendermint/PubKeySecp256k1","value":"AlcobsPzfTNVe7uqAAsndErJAjqplnyudaGB0f+R+p3F"},"signature":"/D74mdIGyIB3/sQvIboLTfS9P9EV/fYGrgHZE2/vNj9X6eM6e57G3atljNB+PABnRw3pTk51uXmhCFop8O/ZJg=="}]}})", output.json());
     ASSERT_EQ(hex(output.signature()), "fc3ef899d206c88077fec42f21ba0b4df4bd3fd115fdf606ae01d9136fef363f57e9e33a7b9ec6ddab658cd07e3c0067470de94e4e75b979a1085a29f0efd926");
@@ -89,12 +94,133 @@ TEST(CosmosSigner, SignTxWithMode) {
     input.set_private_key(privateKey.data(), privateKey.size());
 
     {
-        auto output = Signer::sign(input);
+        auto output = Signer::sign(input, TWCoinTypeCosmos);
         ASSERT_EQ(R"({"mode":"async","tx":{"fee":{"amount":[{"amount":"200","denom":"muon"}],"gas":"200000"},"memo":"","msg":[{"type":"cosmos-sdk/MsgSend","value":{"amount":[{"amount":"1","denom":"muon"}],"from_address":"cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02","to_address":"cosmos1zt50azupanqlfam5afhv3hexwyutnukeh4c573"}}],"signatures":[{"pub_key":{"type":"tendermint/PubKeySecp256k1","value":"AlcobsPzfTNVe7uqAAsndErJAjqplnyudaGB0f+R+p3F"},"signature":"/D74mdIGyIB3/sQvIboLTfS9P9EV/fYGrgHZE2/vNj9X6eM6e57G3atljNB+PABnRw3pTk51uXmhCFop8O/ZJg=="}]}})", output.json());
     }
     input.set_mode(Proto::BroadcastMode::SYNC);
     {
-        auto output = Signer::sign(input);
+        auto output = Signer::sign(input, TWCoinTypeCosmos);
         ASSERT_EQ(R"({"mode":"sync","tx":{"fee":{"amount":[{"amount":"200","denom":"muon"}],"gas":"200000"},"memo":"","msg":[{"type":"cosmos-sdk/MsgSend","value":{"amount":[{"amount":"1","denom":"muon"}],"from_address":"cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02","to_address":"cosmos1zt50azupanqlfam5afhv3hexwyutnukeh4c573"}}],"signatures":[{"pub_key":{"type":"tendermint/PubKeySecp256k1","value":"AlcobsPzfTNVe7uqAAsndErJAjqplnyudaGB0f+R+p3F"},"signature":"/D74mdIGyIB3/sQvIboLTfS9P9EV/fYGrgHZE2/vNj9X6eM6e57G3atljNB+PABnRw3pTk51uXmhCFop8O/ZJg=="}]}})", output.json());
     }
 }
+
+static Proto::SigningInput sendInputProtobuf() {
+    auto input = Proto::SigningInput();
+    input.set_signing_mode(Proto::Protobuf);
+    input.set_account_number(1037);
+    input.set_chain_id("gaia-13003");
+    input.set_memo("");
+    input.set_sequence(8);
+
+    auto fromAddress = Address("cosmos", parse_hex("BC2DA90C84049370D1B7C528BC164BC588833F21"));
+    auto toAddress = Address("cosmos", parse_hex("12E8FE8B81ECC1F4F774EA6EC8DF267138B9F2D9"));
+
+    auto msg = input.add_messages();
+    auto& message = *msg->mutable_send_coins_message();
+    message.set_from_address(fromAddress.string());
+    message.set_to_address(toAddress.string());
+    auto amountOfTx = message.add_amounts();
+    amountOfTx->set_denom("muon");
+    amountOfTx->set_amount(1);
+
+    auto &fee = *input.mutable_fee();
+    fee.set_gas(200000);
+    auto amountOfFee = fee.add_amounts();
+    amountOfFee->set_denom("muon");
+    amountOfFee->set_amount(200);
+
+    auto privateKey = parse_hex("80e81ea269e66a0a05b11236df7919fb7fbeedba87452d667489d7403a02f005");
+    input.set_private_key(privateKey.data(), privateKey.size());
+    return input;
+}
+
+TEST(CosmosSigner, SignTxProtobuf) {
+    auto input = sendInputProtobuf();
+
+    auto publicKey = PrivateKey(input.private_key()).getPublicKey(TWPublicKeyTypeSECP256k1);
+    auto txBody = buildProtoTxBody(input, TWCoinTypeCosmos);
+    auto authInfo = buildAuthInfo(input, publicKey.bytes);
+    EXPECT_EQ(hex(signaturePreimageProto(input, txBody, authInfo)), "0a8c010a89010a1c2f636f736d6f732e62616e6b2e763162657461312e4d736753656e6412690a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b796778306570683664643032122d636f736d6f73317a743530617a7570616e716c66616d356166687633686578777975746e756b656834633537331a090a046d756f6e12013112650a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a210257286ec3f37d33557bbbaa000b27744ac9023aa9967cae75a181d1ff91fa9dc512040a020801180812110a0b0a046d756f6e120332303010c09a0c1a0a676169612d3133303033208d08");
+
+    auto output = Signer::sign(input, TWCoinTypeCosmos);
+
+    EXPECT_EQ(output.error(), Common::Proto::OK);
+    EXPECT_EQ(output.json(), "");
+    EXPECT_EQ(hex(output.signature()), "f9e1f4001657a42009c4eb6859625d2e41e961fc72efd2842909c898e439fc1f549916e4ecac676ee353c7d54c5ae30a29b4210b8bff0ebfdcb375e105002f47");
+    EXPECT_EQ(hex(output.serialized()), "0a8c010a89010a1c2f636f736d6f732e62616e6b2e763162657461312e4d736753656e6412690a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b796778306570683664643032122d636f736d6f73317a743530617a7570616e716c66616d356166687633686578777975746e756b656834633537331a090a046d756f6e12013112650a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a210257286ec3f37d33557bbbaa000b27744ac9023aa9967cae75a181d1ff91fa9dc512040a020801180812110a0b0a046d756f6e120332303010c09a0c1a40f9e1f4001657a42009c4eb6859625d2e41e961fc72efd2842909c898e439fc1f549916e4ecac676ee353c7d54c5ae30a29b4210b8bff0ebfdcb375e105002f47");
+
+    // Same bytes as the reference transaction tx_bytes, broadcast on gaia-13003
+    EXPECT_EQ(Base64::encode(data(output.serialized())), "CowBCokBChwvY29zbW9zLmJhbmsudjFiZXRhMS5Nc2dTZW5kEmkKLWNvc21vczFoc2s2anJ5eXFqZmhwNWRoYzU1dGM5anRja3lneDBlcGg2ZGQwMhItY29zbW9zMXp0NTBhenVwYW5xbGZhbTVhZmh2M2hleHd5dXRudWtlaDRjNTczGgkKBG11b24SATESZQpQCkYKHy9jb3Ntb3MuY3J5cHRvLnNlY3AyNTZrMS5QdWJLZXkSIwohAlcobsPzfTNVe7uqAAsndErJAjqplnyudaGB0f+R+p3FEgQKAggBGAgSEQoLCgRtdW9uEgMyMDAQwJoMGkD54fQAFlekIAnE62hZYl0uQelh/HLv0oQpCciY5Dn8H1SZFuTsrGdu41PH1Uxa4woptCELi/8Ov9yzdeEFAC9H");
+}
+
+TEST(CosmosSigner, SignTxProtobufMultiMessage) {
+    auto input = sendInputProtobuf();
+    input.set_memo("send and stake");
+    auto& stake = *input.add_messages()->mutable_stake_message();
+    stake.set_delegator_address("cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02");
+    stake.set_validator_address("cosmosvaloper1zkupr83hrzkn3up5elktzcq3tuft8nxsmwdqgp");
+    stake.mutable_amount()->set_denom("muon");
+    stake.mutable_amount()->set_amount(10);
+
+    auto publicKey = PrivateKey(input.private_key()).getPublicKey(TWPublicKeyTypeSECP256k1);
+    auto txBody = buildProtoTxBody(input, TWCoinTypeCosmos);
+    auto authInfo = buildAuthInfo(input, publicKey.bytes);
+    EXPECT_EQ(hex(signaturePreimageProto(input, txBody, authInfo)), "0ab7020a89010a1c2f636f736d6f732e62616e6b2e763162657461312e4d736753656e6412690a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b796778306570683664643032122d636f736d6f73317a743530617a7570616e716c66616d356166687633686578777975746e756b656834633537331a090a046d756f6e1201310a98010a232f636f736d6f732e7374616b696e672e763162657461312e4d736744656c656761746512710a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b7967783065706836646430321234636f736d6f7376616c6f706572317a6b757072383368727a6b6e33757035656c6b747a63713374756674386e78736d77647167701a0a0a046d756f6e12023130120e73656e6420616e64207374616b6512650a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a210257286ec3f37d33557bbbaa000b27744ac9023aa9967cae75a181d1ff91fa9dc512040a020801180812110a0b0a046d756f6e120332303010c09a0c1a0a676169612d3133303033208d08");
+
+    auto output = Signer::sign(input, TWCoinTypeCosmos);
+
+    EXPECT_EQ(output.error(), Common::Proto::OK);
+    EXPECT_EQ(hex(output.signature()), "946c730d872e6c5a84690881f7b20e5f369a30aa0fa86fdcd4763b1d55b69eaa2029ab42179a12c2766349482b878bdf0b1259760bd22ef1dc265a261e9b506b");
+    EXPECT_EQ(hex(output.serialized()), "0ab7020a89010a1c2f636f736d6f732e62616e6b2e763162657461312e4d736753656e6412690a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b796778306570683664643032122d636f736d6f73317a743530617a7570616e716c66616d356166687633686578777975746e756b656834633537331a090a046d756f6e1201310a98010a232f636f736d6f732e7374616b696e672e763162657461312e4d736744656c656761746512710a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b7967783065706836646430321234636f736d6f7376616c6f706572317a6b757072383368727a6b6e33757035656c6b747a63713374756674386e78736d77647167701a0a0a046d756f6e12023130120e73656e6420616e64207374616b6512650a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a210257286ec3f37d33557bbbaa000b27744ac9023aa9967cae75a181d1ff91fa9dc512040a020801180812110a0b0a046d756f6e120332303010c09a0c1a40946c730d872e6c5a84690881f7b20e5f369a30aa0fa86fdcd4763b1d55b69eaa2029ab42179a12c2766349482b878bdf0b1259760bd22ef1dc265a261e9b506b");
+
+    // Both messages are packed, in order, into the body
+    auto txRaw = cosmos::tx::v1beta1::TxRaw();
+    ASSERT_TRUE(txRaw.ParseFromString(output.serialized()));
+    auto body = cosmos::tx::v1beta1::TxBody();
+    ASSERT_TRUE(body.ParseFromString(txRaw.body_bytes()));
+    ASSERT_EQ(body.messages_size(), 2);
+    EXPECT_EQ(body.messages(0).type_url(), "/cosmos.bank.v1beta1.MsgSend");
+    EXPECT_EQ(body.messages(1).type_url(), "/cosmos.staking.v1beta1.MsgDelegate");
+    EXPECT_EQ(body.memo(), "send and stake");
+    auto delegate = cosmos::staking::v1beta1::MsgDelegate();
+    ASSERT_TRUE(body.messages(1).UnpackTo(&delegate));
+    EXPECT_EQ(delegate.validator_address(), "cosmosvaloper1zkupr83hrzkn3up5elktzcq3tuft8nxsmwdqgp");
+    EXPECT_EQ(delegate.amount().amount(), "10");
+}
+
+TEST(CosmosSigner, SignTxProtobufRawJsonUnsupported) {
+    auto input = sendInputProtobuf();
+    auto& raw = *input.add_messages()->mutable_raw_json_message();
+    raw.set_type("cosmos-sdk/MsgWithdrawDelegationReward");
+    raw.set_value(R"({"delegator_address":"cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02","validator_address":"cosmosvaloper1zkupr83hrzkn3up5elktzcq3tuft8nxsmwdqgp"})");
+
+    auto output = Signer::sign(input, TWCoinTypeCosmos);
+
+    EXPECT_EQ(output.error(), Common::Proto::Error_general);
+    EXPECT_EQ(output.serialized(), "");
+    EXPECT_EQ(output.signature(), "");
+}
+
+TEST(CosmosSigner, SignTxProtobufMissingKey) {
+    auto input = sendInputProtobuf();
+    input.clear_private_key();
+
+    auto output = Signer::sign(input, TWCoinTypeCosmos);
+
+    EXPECT_EQ(output.error(), Common::Proto::Error_missing_private_key);
+    EXPECT_EQ(output.serialized(), "");
+}
+
+TEST(CosmosSigner, SignTxProtobufSmallerThanJson) {
+    auto input = sendInputProtobuf();
+    for (auto i = 0; i < 20; ++i) {
+        *input.add_messages() = input.messages(0);
+    }
+    const auto protobufOutput = Signer::sign(input, TWCoinTypeCosmos);
+    input.set_signing_mode(Proto::JSON);
+    const auto jsonOutput = Signer::sign(input, TWCoinTypeCosmos);
+
+    ASSERT_EQ(protobufOutput.error(), Common::Proto::OK);
+    ASSERT_FALSE(jsonOutput.json().empty());
+    EXPECT_LT(protobufOutput.serialized().size(), jsonOutput.json().size());
+}
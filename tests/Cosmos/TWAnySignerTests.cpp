@@ -54,3 +54,66 @@ TEST(TWAnySignerCosmos, SignJSON) {
     ASSERT_TRUE(TWAnySignerSupportsJSON(TWCoinTypeCosmos));
     assertStringsEqual(result, R"({"mode":"block","tx":{"fee":{"amount":[{"amount":"5000","denom":"uatom"}],"gas":"200000"},"memo":"Testing","msg":[{"type":"cosmos-sdk/MsgSend","value":{"amount":[{"amount":"995000","denom":"uatom"}],"from_address":"cosmos1ufwv9ymhqaal6xz47n0jhzm2wf4empfqvjy575","to_address":"cosmos135qla4294zxarqhhgxsx0sw56yssa3z0f78pm0"}}],"signatures":[{"pub_key":{"type":"tendermint/PubKeySecp256k1","value":"A6EsukEXB53GhohQVeDpxtkeH8KQIayd/Co/ApYRYkTm"},"signature":"ULEpUqNzoAnYEx2x22F3ANAiPXquAU9+mqLWoAA/ZOUGTMsdb6vryzsW6AKX2Kqj1pGNdrTcQ58Z09JPyjpgEA=="}]}})");
 }
+
+TEST(TWAnySignerCosmos, SignTxProtobuf) {
+    auto privateKey = parse_hex("80e81ea269e66a0a05b11236df7919fb7fbeedba87452d667489d7403a02f005");
+    Proto::SigningInput input;
+    input.set_signing_mode(Proto::Protobuf);
+    input.set_account_number(1037);
+    input.set_chain_id("gaia-13003");
+    input.set_memo("");
+    input.set_sequence(8);
+    input.set_private_key(privateKey.data(), privateKey.size());
+
+    auto fromAddress = Address("cosmos", parse_hex("BC2DA90C84049370D1B7C528BC164BC588833F21"));
+    auto toAddress = Address("cosmos", parse_hex("12E8FE8B81ECC1F4F774EA6EC8DF267138B9F2D9"));
+
+    auto msg = input.add_messages();
+    auto& message = *msg->mutable_send_coins_message();
+    message.set_from_address(fromAddress.string());
+    message.set_to_address(toAddress.string());
+    auto amountOfTx = message.add_amounts();
+    amountOfTx->set_denom("muon");
+    amountOfTx->set_amount(1);
+
+    auto& fee = *input.mutable_fee();
+    fee.set_gas(200000);
+    auto amountOfFee = fee.add_amounts();
+    amountOfFee->set_denom("muon");
+    amountOfFee->set_amount(200);
+
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeCosmos);
+
+        EXPECT_EQ(output.error(), Common::Proto::OK);
+        EXPECT_EQ(hex(output.signature()), "f9e1f4001657a42009c4eb6859625d2e41e961fc72efd2842909c898e439fc1f549916e4ecac676ee353c7d54c5ae30a29b4210b8bff0ebfdcb375e105002f47");
+        EXPECT_EQ(hex(output.serialized()), "0a8c010a89010a1c2f636f736d6f732e62616e6b2e763162657461312e4d736753656e6412690a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b796778306570683664643032122d636f736d6f73317a743530617a7570616e716c66616d356166687633686578777975746e756b656834633537331a090a046d756f6e12013112650a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a210257286ec3f37d33557bbbaa000b27744ac9023aa9967cae75a181d1ff91fa9dc512040a020801180812110a0b0a046d756f6e120332303010c09a0c1a40f9e1f4001657a42009c4eb6859625d2e41e961fc72efd2842909c898e439fc1f549916e4ecac676ee353c7d54c5ae30a29b4210b8bff0ebfdcb375e105002f47");
+    }
+
+    auto& stake = *input.add_messages()->mutable_stake_message();
+    stake.set_delegator_address("cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02");
+    stake.set_validator_address("cosmosvaloper1zkupr83hrzkn3up5elktzcq3tuft8nxsmwdqgp");
+    stake.mutable_amount()->set_denom("muon");
+    stake.mutable_amount()->set_amount(10);
+    input.set_memo("send and stake");
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeCosmos);
+
+        EXPECT_EQ(output.error(), Common::Proto::OK);
+        EXPECT_EQ(hex(output.signature()), "946c730d872e6c5a84690881f7b20e5f369a30aa0fa86fdcd4763b1d55b69eaa2029ab42179a12c2766349482b878bdf0b1259760bd22ef1dc265a261e9b506b");
+        EXPECT_EQ(hex(output.serialized()), "0ab7020a89010a1c2f636f736d6f732e62616e6b2e763162657461312e4d736753656e6412690a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b796778306570683664643032122d636f736d6f73317a743530617a7570616e716c66616d356166687633686578777975746e756b656834633537331a090a046d756f6e1201310a98010a232f636f736d6f732e7374616b696e672e763162657461312e4d736744656c656761746512710a2d636f736d6f733168736b366a727979716a6668703564686335357463396a74636b7967783065706836646430321234636f736d6f7376616c6f706572317a6b757072383368727a6b6e33757035656c6b747a63713374756674386e78736d77647167701a0a0a046d756f6e12023130120e73656e6420616e64207374616b6512650a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a210257286ec3f37d33557bbbaa000b27744ac9023aa9967cae75a181d1ff91fa9dc512040a020801180812110a0b0a046d756f6e120332303010c09a0c1a40946c730d872e6c5a84690881f7b20e5f369a30aa0fa86fdcd4763b1d55b69eaa2029ab42179a12c2766349482b878bdf0b1259760bd22ef1dc265a261e9b506b");
+    }
+
+    auto& raw = *input.add_messages()->mutable_raw_json_message();
+    raw.set_type("cosmos-sdk/MsgWithdrawDelegationReward");
+    raw.set_value(R"({"delegator_address":"cosmos1hsk6jryyqjfhp5dhc55tc9jtckygx0eph6dd02","validator_address":"cosmosvaloper1zkupr83hrzkn3up5elktzcq3tuft8nxsmwdqgp"})");
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeCosmos);
+
+        EXPECT_EQ(output.error(), Common::Proto::Error_general);
+        EXPECT_EQ(output.serialized(), "");
+    }
+}
@@ -0,0 +1,90 @@
+// Copyright © 2017-2020 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Crc.h"
+#include "Data.h"
+#include "HexCoding.h"
+
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace TW;
+
+namespace {
+
+/// Bit-by-bit reference implementations
+uint16_t crc16Reference(const Data& data) {
+    uint16_t crc = 0;
+    for (auto value : data) {
+        crc ^= static_cast<uint16_t>(value << 8);
+        for (auto bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+        }
+    }
+    return crc;
+}
+
+uint32_t crc32Reference(const TW::byte* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (auto bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1) ? (0xEDB88320 ^ (crc >> 1)) : (crc >> 1);
+        }
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+Data pseudoRandomData(size_t size) {
+    Data data(size);
+    uint32_t state = 0x12345678;
+    for (auto& value : data) {
+        state = state * 1103515245 + 12345;
+        value = static_cast<TW::byte>(state >> 16);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST(Crc, Crc16CheckValue) {
+    auto data = TW::data(string("123456789"));
+    EXPECT_EQ(Crc::crc16(data.data(), static_cast<uint32_t>(data.size())), 0x31C3);
+    EXPECT_EQ(Crc::crc16(data.data(), 0), 0x0000);
+}
+
+TEST(Crc, Crc16MatchesBitwise) {
+    for (auto size : {1, 2, 7, 33, 35, 100, 1000}) {
+        auto data = pseudoRandomData(size);
+        EXPECT_EQ(Crc::crc16(data.data(), static_cast<uint32_t>(data.size())), crc16Reference(data)) << size;
+    }
+}
+
+TEST(Crc, Crc32CheckValue) {
+    EXPECT_EQ(Crc::crc32(TW::data(string("123456789"))), 0xCBF43926);
+    EXPECT_EQ(Crc::crc32(TW::data(string("The quick brown fox jumps over the lazy dog"))), 0x414FA339);
+    EXPECT_EQ(Crc::crc32(Data()), 0x00000000);
+}
+
+TEST(Crc, Crc32MatchesBitwise) {
+    // Covers the byte-wise tail, slicing-by-8 and the 64-byte folding path, at every alignment
+    const auto data = pseudoRandomData(4096 + 16);
+    for (size_t size = 0; size <= 300; ++size) {
+        for (size_t offset = 0; offset < 16; offset += 5) {
+            ASSERT_EQ(Crc::crc32(data.data() + offset, size), crc32Reference(data.data() + offset, size))
+                << "size " << size << " offset " << offset;
+        }
+    }
+    for (auto size : {1023, 1024, 1025, 4096}) {
+        EXPECT_EQ(Crc::crc32(data.data() + 3, size), crc32Reference(data.data() + 3, size)) << size;
+    }
+}
+
+TEST(Crc, Crc32DataOverload) {
+    const auto data = parse_hex("83581ce4a4e11b8bf2fa5bb0e3a3b4f1da6ecf56e3c67fc8ae93ebef1c0f56a101581e581c4a2d8e7c3f5f0a8e6cc7f6e1d4a7b1b08d0a9d2e9e3f2f7c2b8c4a1d00");
+    EXPECT_EQ(Crc::crc32(data), Crc::crc32(data.data(), data.size()));
+    EXPECT_EQ(Crc::crc32(data), crc32Reference(data.data(), data.size()));
+}
@@ -43,6 +43,19 @@ TEST(TWAnySignerEOS, Sign) {
         EXPECT_EQ(output.json_encoded(), R"({"compression":"none","packed_context_free_data":"","packed_trx":"7c59a35cd6679a1f3d4800000000010000000080a920cd000000572d3ccdcd010000000080a920cd00000000a8ed3232330000000080a920cd0000000000ea3055e09304000000000004544b4e00000000126d79207365636f6e64207472616e7366657200","signatures":["SIG_K1_KfCdjsrTnx5cBpbA5cUdHZAsRYsnC9uKzuS1shFeqfMCfdZwX4PBm9pfHwGRT6ffz3eavhtkyNci5GoFozQAx8P8PBnDmj"]})");
     }
 
+    input.set_output_format(Common::Proto::Output_raw);
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeEOS);
+
+        EXPECT_EQ(output.error(), Common::Proto::OK);
+        EXPECT_TRUE(output.json_encoded().empty());
+        // one K1 signature (key type and 65 bytes), no compression, no context-free data, the packed transaction
+        EXPECT_EQ(hex(output.encoded()).substr(0, 6), "010020");
+        EXPECT_EQ(hex(output.encoded()).substr(136), "00657c59a35cd6679a1f3d4800000000010000000080a920cd000000572d3ccdcd010000000080a920cd00000000a8ed3232330000000080a920cd0000000000ea3055e09304000000000004544b4e00000000126d79207365636f6e64207472616e7366657200");
+    }
+
+    input.set_output_format(Common::Proto::Output_raw_and_json);
     input.set_private_key_type(Proto::KeyType::LEGACY);
     {
         Proto::SigningOutput output;
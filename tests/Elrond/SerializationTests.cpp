@@ -58,3 +58,19 @@ TEST(ElrondSerialization, SignableStringWithoutData) {
     string jsonString = serializeTransaction(message);
     ASSERT_EQ(R"({"nonce":42,"value":"43","receiver":"abba","sender":"feed","gasPrice":0,"gasLimit":0,"chainID":"1","version":1})", jsonString);
 }
+
+TEST(ElrondSerialization, SignableStringEscaped) {
+    Proto::TransactionMessage message;
+    message.set_nonce(18446744073709551615ULL);
+    message.set_value("4\"3");
+    message.set_sender("al\\ice");
+    message.set_receiver("b\tob\x01");
+    message.set_chain_id("ch\xc3\xa9");
+    message.set_version(4294967295);
+
+    string jsonString = serializeTransaction(message);
+    ASSERT_EQ(R"({"nonce":18446744073709551615,"value":"4\"3","receiver":"b\tob\u0001","sender":"al\\ice","gasPrice":0,"gasLimit":0,"chainID":"ch)" "\xc3\xa9" R"(","version":4294967295})", jsonString);
+
+    string signedString = serializeSignedTransaction(message, "ab\ncd");
+    ASSERT_EQ(R"({"nonce":18446744073709551615,"value":"4\"3","receiver":"b\tob\u0001","sender":"al\\ice","gasPrice":0,"gasLimit":0,"chainID":"ch)" "\xc3\xa9" R"(","version":4294967295,"signature":"ab\ncd"})", signedString);
+}
@@ -41,6 +41,16 @@ TEST(ElrondSigner, Sign) {
 
     ASSERT_EQ(expectedSignature, signature);
     ASSERT_EQ(expectedEncoded, encoded);
+
+    input.set_output_format(Common::Proto::Output_raw);
+    output = Signer::sign(input);
+    EXPECT_EQ(expectedSignature, output.signature());
+    EXPECT_TRUE(output.encoded().empty());
+
+    input.set_output_format(Common::Proto::Output_json);
+    output = Signer::sign(input);
+    EXPECT_TRUE(output.signature().empty());
+    EXPECT_EQ(expectedEncoded, output.encoded());
 }
 
 TEST(ElrondSigner, SignJSON) {
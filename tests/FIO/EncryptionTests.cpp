@@ -182,3 +182,62 @@ TEST(FIOEncryption, encryptEncodeDecodeDecrypt) {
     // verify that decrypted is the same as the original
     EXPECT_EQ(hex(decrypted), hex(message));
 }
+
+TEST(FIOEncryption, decryptorCachesSharedSecrets) {
+    const PrivateKey privateKeyAlice(parse_hex("2bd806c97f0e00af1a1fc3328fa763a9269723c8db8fac4f93af71db186d6e90"));
+    const PrivateKey privateKeyBob(parse_hex("81b637d8fcd2c6da6359e6963113a1170de795e4b725b84d1e0b4cfd9ec58ce9"));
+    const PrivateKey privateKeyCarol(parse_hex("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"));
+    const PublicKey publicKeyAlice = privateKeyAlice.getPublicKey(TWPublicKeyTypeSECP256k1);
+    const PublicKey publicKeyCarol = privateKeyCarol.getPublicKey(TWPublicKeyTypeSECP256k1);
+
+    Decryptor bob(privateKeyBob);
+    EXPECT_EQ(hex(bob.sharedSecret(publicKeyAlice)), "a71b4ec5a9577926a1d2aa1d9d99327fd3b68f6a1ea597200a0d890bd3331df300a2d49fec0b2b3e6969ce9263c5d6cf47c191c1ef149373ecc9f0d98116b598");
+    EXPECT_EQ(hex(bob.sharedSecret(publicKeyAlice)), hex(Encryption::getSharedSecret(privateKeyBob, publicKeyAlice)));
+    EXPECT_EQ(bob.cachedSecrets(), 1);
+
+    const Data message = parse_hex("0b70757273652e616c69636501310a66696f2e7265716f6274000000");
+    const Data encrypted = Encryption::encrypt(privateKeyAlice, privateKeyBob.getPublicKey(TWPublicKeyTypeSECP256k1), message, parse_hex("f300888ca4f512cebdc0020ff0f7224c"));
+    EXPECT_EQ(hex(bob.decrypt(publicKeyAlice, encrypted)), hex(message));
+    EXPECT_EQ(bob.cachedSecrets(), 1);
+
+    EXPECT_THROW(bob.sharedSecret(PublicKey(parse_hex("020000000000000000000000000000000000000000000000000000000000000005"), TWPublicKeyTypeSECP256k1)), std::invalid_argument);
+    EXPECT_EQ(bob.cachedSecrets(), 1);
+    EXPECT_THROW(bob.decrypt(publicKeyCarol, encrypted), std::invalid_argument);
+    EXPECT_EQ(bob.cachedSecrets(), 2);
+}
+
+TEST(FIOEncryption, decryptorDecryptAll) {
+    const PrivateKey privateKeyBob(parse_hex("81b637d8fcd2c6da6359e6963113a1170de795e4b725b84d1e0b4cfd9ec58ce9"));
+    const PublicKey publicKeyBob = privateKeyBob.getPublicKey(TWPublicKeyTypeSECP256k1);
+    const std::vector<PrivateKey> senders = {
+        PrivateKey(parse_hex("2bd806c97f0e00af1a1fc3328fa763a9269723c8db8fac4f93af71db186d6e90")),
+        PrivateKey(parse_hex("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855")),
+    };
+
+    std::vector<Decryptor::EncodedMessage> messages;
+    std::vector<Data> plaintexts;
+    for (auto i = 0; i < 12; ++i) {
+        const auto& sender = senders[i % 2];
+        plaintexts.push_back(TW::data("request " + std::to_string(i)));
+        const auto encrypted = Encryption::encrypt(sender, publicKeyBob, plaintexts.back(), Data());
+        messages.emplace_back(sender.getPublicKey(TWPublicKeyTypeSECP256k1), Encryption::encode(encrypted));
+    }
+    // tampered content and garbage
+    messages[3].second[10] = messages[3].second[10] == 'A' ? 'B' : 'A';
+    messages.emplace_back(messages[0].first, "not base64!");
+
+    Decryptor bob(privateKeyBob);
+    const auto results = bob.decryptAll(messages);
+    ASSERT_EQ(results.size(), messages.size());
+    for (auto i = 0; i < 12; ++i) {
+        if (i == 3) {
+            EXPECT_FALSE(results[i].has_value());
+            continue;
+        }
+        ASSERT_TRUE(results[i].has_value()) << i;
+        EXPECT_EQ(hex(*results[i]), hex(plaintexts[i]));
+    }
+    EXPECT_FALSE(results[12].has_value());
+    EXPECT_EQ(bob.cachedSecrets(), 2);
+    EXPECT_TRUE(bob.decryptAll({}).empty());
+}
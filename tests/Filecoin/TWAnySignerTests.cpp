@@ -7,6 +7,7 @@
 #include "../interface/TWTestUtilities.h"
 #include <TrustWalletCore/TWAnySigner.h>
 
+#include "Base64.h"
 #include "Data.h"
 #include "HexCoding.h"
 #include "proto/Filecoin.pb.h"
@@ -67,3 +68,41 @@ TEST(TWAnySignerFilecoin, SignJSON) {
     ASSERT_TRUE(TWAnySignerSupportsJSON(TWCoinTypeFilecoin));
     assertStringsEqual(result, R"({"Message":{"From":"f1z4a36sc7mfbv4z3qwutblp2flycdui3baffytbq","GasFeeCap":"700000000000000000000","GasLimit":1000,"GasPremium":"800000000000000000000","Nonce":2,"To":"f3um6uo3qt5of54xjbx3hsxbw5mbsc6auxzrvfxekn5bv3duewqyn2tg5rhrlx73qahzzpkhuj7a34iq7oifsq","Value":"600000000000000000000"},"Signature":{"Data":"jMRu+OZ/lfppgmqSfGsntFrRLWZnUg3ZYmJTTRLsVt4V1310vR3VKGJpaE6S4sNvDOE6sEgmN9YmfTkPVK2qMgE=","Type":1}})");
 }
+
+TEST(TWAnySignerFilecoin, SignOutputFormat) {
+    Proto::SigningInput input;
+    auto privateKey = parse_hex("1d969865e189957b9824bd34f26d5cbf357fda1a6d844cbf0c9ab1ed93fa7dbe");
+    auto value = store(uint256_t(600) * uint256_t(1'000'000'000) * uint256_t(1'000'000'000));
+    auto gasFeeCap = store(uint256_t(700) * uint256_t(1'000'000'000) * uint256_t(1'000'000'000));
+    auto gasPremium = store(uint256_t(800) * uint256_t(1'000'000'000) * uint256_t(1'000'000'000));
+    input.set_private_key(privateKey.data(), privateKey.size());
+    input.set_to("f3um6uo3qt5of54xjbx3hsxbw5mbsc6auxzrvfxekn5bv3duewqyn2tg5rhrlx73qahzzpkhuj7a34iq7oifsq");
+    input.set_nonce(2);
+    input.set_value(value.data(), value.size());
+    input.set_gas_limit(1000);
+    input.set_gas_fee_cap(gasFeeCap.data(), gasFeeCap.size());
+    input.set_gas_premium(gasPremium.data(), gasPremium.size());
+
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeFilecoin);
+        EXPECT_EQ(Base64::encode(data(output.signature())), "jMRu+OZ/lfppgmqSfGsntFrRLWZnUg3ZYmJTTRLsVt4V1310vR3VKGJpaE6S4sNvDOE6sEgmN9YmfTkPVK2qMgE=");
+        EXPECT_FALSE(output.json().empty());
+    }
+
+    input.set_output_format(Common::Proto::Output_raw);
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeFilecoin);
+        EXPECT_EQ(output.signature().size(), 65);
+        EXPECT_TRUE(output.json().empty());
+    }
+
+    input.set_output_format(Common::Proto::Output_json);
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeFilecoin);
+        EXPECT_TRUE(output.signature().empty());
+        EXPECT_FALSE(output.json().empty());
+    }
+}
@@ -200,4 +200,126 @@ TEST(HDWallet, DeriveWithLeadingZerosEth) {
     EXPECT_EQ(addr.string(), "0x0ba17e928471c64AaEaf3ABfB3900EF4c27b380D");
 }
 
+TEST(HDWallet, publicKeysFromExtended) {
+    // abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about
+    const std::string zpub = "zpub6rFR7y4Q2AijBEqTUquhVz398htDFrtymD9xYYfG1m4wAcvPhXNfE3EfH1r1ADqtfSdVCToUG868RvUUkgDKf31mGDtKsAYz2oz2AGutZYs";
+    const auto keys = HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, 0, 0, 5);
+    ASSERT_EQ(keys.size(), 5);
+    EXPECT_EQ(Bitcoin::SegwitAddress(keys[0], 0, "bc").string(), "bc1qcr8te4kr609gcawutmrza0j4xv80jy8z306fyu");
+    for (uint32_t i = 0; i < 5; ++i) {
+        const auto key = HDWallet::getPublicKeyFromExtended(zpub, TWCoinTypeBitcoin, DerivationPath(TWPurposeBIP84, 0, 0, 0, i));
+        ASSERT_TRUE(key.has_value());
+        EXPECT_EQ(hex(keys[i].bytes), hex(key->bytes));
+    }
+
+    const auto change = HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, 1, 3, 2);
+    ASSERT_EQ(change.size(), 2);
+    EXPECT_EQ(hex(change[1].bytes), hex(HDWallet::getPublicKeyFromExtended(zpub, TWCoinTypeBitcoin, DerivationPath(TWPurposeBIP84, 0, 0, 1, 4))->bytes));
+
+    EXPECT_TRUE(HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, 0, 0, 0).empty());
+    EXPECT_TRUE(HDWallet::getPublicKeysFromExtended("invalid", TWCoinTypeBitcoin, 0, 0, 5).empty());
+    EXPECT_TRUE(HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeSolana, 0, 0, 5).empty());
+
+    // hardened indices can't be derived from a public key
+    const uint32_t hardened = 0x80000000;
+    EXPECT_THROW(HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, hardened, 0, 1), std::invalid_argument);
+    EXPECT_THROW(HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, 0, hardened, 1), std::invalid_argument);
+    EXPECT_THROW(HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, 0, hardened - 2, 3), std::invalid_argument);
+    EXPECT_THROW(HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, 0, 1, UINT32_MAX), std::invalid_argument);
+    const auto last = HDWallet::getPublicKeysFromExtended(zpub, TWCoinTypeBitcoin, 0, hardened - 2, 2);
+    ASSERT_EQ(last.size(), 2);
+    EXPECT_EQ(hex(last[1].bytes), hex(HDWallet::getPublicKeyFromExtended(zpub, TWCoinTypeBitcoin, DerivationPath(TWPurposeBIP84, 0, 0, 0, hardened - 1))->bytes));
+    EXPECT_NE(hex(last[0].bytes), hex(last[1].bytes));
+}
+
+TEST(HDWallet, getKeys) {
+    const auto wallet = HDWallet("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about", "");
+    const auto parent = DerivationPath("m/84'/0'/0'/1");
+    const auto keys = wallet.getKeys(TWCoinTypeBitcoin, parent, 3, 4, false);
+    ASSERT_EQ(keys.size(), 4);
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(hex(keys[i].bytes), hex(wallet.getKey(TWCoinTypeBitcoin, DerivationPath(TWPurposeBIP84, 0, 0, 1, 3 + i)).bytes));
+    }
+
+    const auto hardened = wallet.getKeys(TWCoinTypeSolana, DerivationPath("m/44'/501'"), 0, 2, true);
+    ASSERT_EQ(hardened.size(), 2);
+    EXPECT_EQ(hex(hardened[1].bytes), hex(wallet.getKey(TWCoinTypeSolana, DerivationPath("m/44'/501'/1'")).bytes));
+
+    const auto cardano = wallet.getKeys(TWCoinTypeCardano, DerivationPath("m/1852'/1815'/0'/0"), 0, 1, false);
+    ASSERT_EQ(cardano.size(), 1);
+    EXPECT_EQ(hex(cardano[0].bytes), hex(wallet.getKey(TWCoinTypeCardano, DerivationPath("m/1852'/1815'/0'/0/0")).bytes));
+    EXPECT_EQ(hex(cardano[0].extensionBytes), hex(wallet.getKey(TWCoinTypeCardano, DerivationPath("m/1852'/1815'/0'/0/0")).extensionBytes));
+
+    EXPECT_TRUE(wallet.getKeys(TWCoinTypeBitcoin, parent, 0, 0, false).empty());
+
+    // ed25519 has no soft derivation, the parent key must not be handed out instead
+    EXPECT_THROW(wallet.getKeys(TWCoinTypeSolana, DerivationPath("m/44'/501'"), 0, 2, false), std::invalid_argument);
+    EXPECT_THROW(wallet.getKeys(TWCoinTypeNano, DerivationPath("m/44'/165'"), 0, 1, false), std::invalid_argument);
+    EXPECT_THROW(wallet.getKeys(TWCoinTypeBitcoin, parent, 0x80000000, 1, false), std::invalid_argument);
+    EXPECT_THROW(wallet.getKeys(TWCoinTypeBitcoin, parent, 0x7fffffff, 2, false), std::invalid_argument);
+    EXPECT_EQ(wallet.getKeys(TWCoinTypeBitcoin, parent, 0x7fffffff, 1, false).size(), 1);
+}
+
+TEST(HDWallet, getExtendedPublicKeyAccount) {
+    const auto wallet = HDWallet("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about", "");
+    EXPECT_EQ(wallet.getExtendedPublicKey(TWPurposeBIP84, TWCoinTypeBitcoin, TWHDVersionZPUB, 0), "zpub6rFR7y4Q2AijBEqTUquhVz398htDFrtymD9xYYfG1m4wAcvPhXNfE3EfH1r1ADqtfSdVCToUG868RvUUkgDKf31mGDtKsAYz2oz2AGutZYs");
+    const auto account1 = wallet.getExtendedPublicKey(TWPurposeBIP84, TWCoinTypeBitcoin, TWHDVersionZPUB, 1);
+    const auto key = HDWallet::getPublicKeyFromExtended(account1, TWCoinTypeBitcoin, DerivationPath("m/84'/0'/1'/0/7"));
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(hex(key->bytes), hex(wallet.getKey(TWCoinTypeBitcoin, DerivationPath("m/84'/0'/1'/0/7")).getPublicKey(TWPublicKeyTypeSECP256k1).bytes));
+}
+
+TEST(HDWallet, getKeyCachedEd25519Nodes) {
+    const auto paths = std::vector<std::pair<TWCoinType, std::string>>{
+        {TWCoinTypeSolana, "m/44'/501'/0'"},
+        {TWCoinTypeSolana, "m/44'/501'/1'"},
+        {TWCoinTypeSolana, "m/44'/501'/0'/0'"},
+        {TWCoinTypeStellar, "m/44'/148'/2'"},
+        {TWCoinTypeNano, "m/44'/165'/0'"},
+        {TWCoinTypeWaves, "m/44'/5741564'/0'/0'/0'"},
+        {TWCoinTypeWaves, "m/44'/5741564'/0'/0'/1'"},
+        {TWCoinTypeCardano, "m/1852'/1815'/0'/0/0"},
+        {TWCoinTypeCardano, "m/1852'/1815'/0'/0/1"},
+        {TWCoinTypeCardano, "m/1852'/1815'/0'/2/0"},
+    };
+
+    // every path is derived twice by the same wallet, and by a fresh wallet that has nothing cached
+    const auto wallet = HDWallet(mnemonic1, passphrase);
+    const auto copy = wallet;
+    for (int round = 0; round < 2; ++round) {
+        for (const auto& [coin, path] : paths) {
+            const auto key = (round == 0 ? wallet : copy).getKey(coin, DerivationPath(path));
+            const auto expected = HDWallet(mnemonic1, passphrase).getKey(coin, DerivationPath(path));
+            EXPECT_EQ(hex(key.bytes), hex(expected.bytes)) << path;
+            EXPECT_EQ(hex(key.extensionBytes), hex(expected.extensionBytes)) << path;
+            EXPECT_EQ(hex(key.chainCodeBytes), hex(expected.chainCodeBytes)) << path;
+        }
+    }
+
+    // siblings share the cached parent but stay distinct
+    EXPECT_NE(hex(wallet.getKey(TWCoinTypeSolana, DerivationPath("m/44'/501'/0'")).bytes), hex(wallet.getKey(TWCoinTypeSolana, DerivationPath("m/44'/501'/1'")).bytes));
+    EXPECT_EQ(hex(wallet.getMasterKey(TWCurveED25519).bytes), hex(HDWallet(mnemonic1, passphrase).getKey(TWCoinTypeSolana, DerivationPath(std::vector<DerivationPathIndex>{})).bytes));
+}
+
+TEST(HDWallet, getPublicKeys) {
+    const auto wallet = HDWallet(mnemonic1, passphrase);
+    const auto solana = wallet.getPublicKeys(TWCoinTypeSolana, DerivationPath("m/44'/501'"), 2, 3, true);
+    ASSERT_EQ(solana.size(), 3);
+    for (uint32_t i = 0; i < 3; ++i) {
+        const auto path = DerivationPath("m/44'/501'/" + std::to_string(2 + i) + "'");
+        EXPECT_EQ(solana[i].type, TWPublicKeyTypeED25519);
+        EXPECT_EQ(hex(solana[i].bytes), hex(wallet.getKey(TWCoinTypeSolana, path).getPublicKey(TWPublicKeyTypeED25519).bytes));
+    }
+
+    const auto bitcoin = wallet.getPublicKeys(TWCoinTypeBitcoin, DerivationPath("m/84'/0'/0'/0"), 0, 2, false);
+    ASSERT_EQ(bitcoin.size(), 2);
+    EXPECT_EQ(hex(bitcoin[1].bytes), hex(wallet.getKey(TWCoinTypeBitcoin, DerivationPath("m/84'/0'/0'/0/1")).getPublicKey(TWPublicKeyTypeSECP256k1).bytes));
+
+    EXPECT_TRUE(wallet.getPublicKeys(TWCoinTypeStellar, DerivationPath("m/44'/148'"), 0, 0, true).empty());
+
+    // soft derivation on ed25519 would repeat the parent's public key for every index
+    EXPECT_THROW(wallet.getPublicKeys(TWCoinTypeSolana, DerivationPath("m/44'/501'"), 0, 3, false), std::invalid_argument);
+    EXPECT_THROW(wallet.getPublicKeys(TWCoinTypeBitcoin, DerivationPath("m/84'/0'/0'/0"), 0x7ffffffe, 3, false), std::invalid_argument);
+}
+
 } // namespace
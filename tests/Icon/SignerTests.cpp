@@ -0,0 +1,59 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Icon/Signer.h"
+#include "HexCoding.h"
+#include "uint256.h"
+
+#include <gtest/gtest.h>
+
+using namespace TW;
+using namespace TW::Icon;
+
+namespace {
+
+Proto::SigningInput makeInput() {
+    auto input = Proto::SigningInput();
+    input.set_from_address("hxbe258ceb872e08851f1f59694dac2558708ece11");
+    input.set_to_address("hx5bfdb090f43a808005ffc27c25b213145e80b7cd");
+    const auto value = store(uint256_t(1000000000000000000));
+    input.set_value(value.data(), value.size());
+    const auto stepLimit = store(uint256_t("74565"));
+    input.set_step_limit(stepLimit.data(), stepLimit.size());
+    const auto one = store(uint256_t(1));
+    input.set_network_id(one.data(), one.size());
+    input.set_nonce(one.data(), one.size());
+    input.set_timestamp(1516942975500598);
+    return input;
+}
+
+} // namespace
+
+TEST(IconSigner, PreImage) {
+    const auto input = makeInput();
+    EXPECT_EQ(Signer(input).preImage(),
+              "icx_sendTransaction.from.hxbe258ceb872e08851f1f59694dac2558708ece11.nid.0x1.nonce.0x1.stepLimit.0x12345"
+              ".timestamp.0x563a6cf330136.to.hx5bfdb090f43a808005ffc27c25b213145e80b7cd.value.0xde0b6b3a7640000"
+              ".version.0x3");
+}
+
+TEST(IconSigner, PreImageNumbers) {
+    auto input = makeInput();
+    // zero, empty and zero-padded numbers
+    const auto zero = parse_hex("0000");
+    input.set_nonce(zero.data(), zero.size());
+    input.clear_network_id();
+    const auto padded = parse_hex("000f0100");
+    input.set_step_limit(padded.data(), padded.size());
+    input.set_timestamp(0);
+
+    const auto preImage = Signer(input).preImage();
+    EXPECT_NE(preImage.find(".nid.0x0.nonce.0x0.stepLimit.0xf0100.timestamp.0x0."), std::string::npos) << preImage;
+
+    // negative timestamps print as two's complement
+    input.set_timestamp(-1);
+    EXPECT_NE(Signer(input).preImage().find(".timestamp.0xffffffffffffffff."), std::string::npos);
+}
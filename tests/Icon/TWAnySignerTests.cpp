@@ -46,3 +46,37 @@ TEST(TWAnySignerIcon, Sign) {
     auto expected = std::string("{\"from\":\"hxbe258ceb872e08851f1f59694dac2558708ece11\",\"nid\":\"0x1\",\"nonce\":\"0x1\",\"signature\":\"xR6wKs+IA+7E91bT8966jFKlK5mayutXCvayuSMCrx9KB7670CsWa0B7LQzgsxU0GLXaovlAT2MLs1XuDiSaZQE=\",\"stepLimit\":\"0x12345\",\"timestamp\":\"0x563a6cf330136\",\"to\":\"hx5bfdb090f43a808005ffc27c25b213145e80b7cd\",\"value\":\"0xde0b6b3a7640000\",\"version\":\"0x3\"}");
     ASSERT_EQ(output.encoded(), expected);
 }
+
+TEST(TWAnySignerIcon, SignOutputFormat) {
+    auto key = parse_hex("2d42994b2f7735bbc93a3e64381864d06747e574aa94655c516f9ad0a74eed79");
+    auto input = Proto::SigningInput();
+    input.set_from_address("hxbe258ceb872e08851f1f59694dac2558708ece11");
+    input.set_to_address("hx5bfdb090f43a808005ffc27c25b213145e80b7cd");
+    auto valueData = store(uint256_t(1000000000000000000));
+    input.set_value(valueData.data(), valueData.size());
+    auto stepLimitData = store(uint256_t("74565"));
+    input.set_step_limit(stepLimitData.data(), stepLimitData.size());
+    auto oneData = store(uint256_t("01"));
+    input.set_network_id(oneData.data(), oneData.size());
+    input.set_nonce(oneData.data(), oneData.size());
+    input.set_timestamp(1516942975500598);
+    input.set_private_key(key.data(), key.size());
+
+    const auto signature = "c51eb02acf8803eec4f756d3f3deba8c52a52b999acaeb570af6b2b92302af1f4a07bebbd02b166b407b2d0ce0b3153418b5daa2f9404f630bb355ee0e249a6501";
+
+    input.set_output_format(Common::Proto::Output_raw);
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeICON);
+        EXPECT_EQ(hex(output.signature()), signature);
+        EXPECT_TRUE(output.encoded().empty());
+    }
+
+    input.set_output_format(Common::Proto::Output_json);
+    {
+        Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeICON);
+        EXPECT_TRUE(output.signature().empty());
+        EXPECT_NE(output.encoded().find("xR6wKs+IA+7E91bT8966jFKlK5mayutXCvayuSMCrx9KB7670CsWa0B7LQzgsxU0GLXaovlAT2MLs1XuDiSaZQE="), std::string::npos);
+    }
+}
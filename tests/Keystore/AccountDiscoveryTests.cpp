@@ -0,0 +1,125 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Keystore/AccountDiscovery.h"
+#include "Keystore/StoredKey.h"
+
+#include "Coin.h"
+#include "HDWallet.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <stdexcept>
+
+namespace TW::Keystore {
+
+using namespace std;
+
+const auto discoveryMnemonic = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
+
+string addressAt(const HDWallet& wallet, TWCoinType coin, const string& path) {
+    return TW::deriveAddress(coin, wallet.getKey(coin, DerivationPath(path)));
+}
+
+TEST(AccountDiscovery, Discover) {
+    const auto wallet = HDWallet(discoveryMnemonic, "");
+    const auto btc = TWCoinTypeBitcoin;
+    const auto eth = TWCoinTypeEthereum;
+    const auto xlm = TWCoinTypeStellar;
+
+    const auto usedPaths = vector<pair<TWCoinType, string>>{
+        {btc, "m/84'/0'/0'/0/0"},
+        {btc, "m/84'/0'/0'/0/5"},
+        {btc, "m/84'/0'/0'/0/25"}, // last used + gap limit, still found
+        {btc, "m/84'/0'/0'/1/2"},
+        {btc, "m/84'/0'/1'/0/0"},
+        {btc, "m/84'/0'/3'/0/0"}, // account 2 unused, never reached
+        {btc, "m/84'/0'/1'/1/21"}, // beyond the gap of the change chain
+        {eth, "m/44'/60'/0'/0/0"},
+        {xlm, "m/44'/148'/0'"},
+        {xlm, "m/44'/148'/1'"},
+    };
+    set<string> used;
+    for (const auto& [coin, path] : usedPaths) {
+        used.insert(addressAt(wallet, coin, path));
+    }
+    ASSERT_EQ(addressAt(wallet, btc, "m/84'/0'/0'/0/0"), "bc1qcr8te4kr609gcawutmrza0j4xv80jy8z306fyu");
+
+    atomic<size_t> calls{0};
+    const auto accounts = AccountDiscovery().discover(wallet, {btc, eth, xlm}, [&](TWCoinType, const string& address) {
+        ++calls;
+        return used.count(address) > 0;
+    });
+
+    const auto expected = vector<pair<TWCoinType, string>>{
+        {btc, "m/84'/0'/0'/0/0"},
+        {btc, "m/84'/0'/0'/0/5"},
+        {btc, "m/84'/0'/0'/0/25"},
+        {btc, "m/84'/0'/0'/1/2"},
+        {btc, "m/84'/0'/1'/0/0"},
+        {eth, "m/44'/60'/0'/0/0"},
+        {xlm, "m/44'/148'/0'"},
+        {xlm, "m/44'/148'/1'"},
+    };
+    ASSERT_EQ(accounts.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const auto& [coin, path] = expected[i];
+        EXPECT_EQ(accounts[i].coin, coin) << path;
+        EXPECT_EQ(accounts[i].derivationPath.string(), path);
+        EXPECT_EQ(accounts[i].address, addressAt(wallet, coin, path));
+    }
+
+    EXPECT_EQ(accounts[0].extendedPublicKey, "zpub6rFR7y4Q2AijBEqTUquhVz398htDFrtymD9xYYfG1m4wAcvPhXNfE3EfH1r1ADqtfSdVCToUG868RvUUkgDKf31mGDtKsAYz2oz2AGutZYs");
+    EXPECT_EQ(accounts[3].extendedPublicKey, accounts[0].extendedPublicKey);
+    EXPECT_EQ(accounts[4].extendedPublicKey, wallet.getExtendedPublicKey(TWPurposeBIP84, btc, TWHDVersionZPUB, 1));
+    EXPECT_NE(accounts[4].extendedPublicKey, accounts[0].extendedPublicKey);
+    EXPECT_EQ(accounts[5].extendedPublicKey, "");
+    EXPECT_EQ(accounts[6].extendedPublicKey, "");
+
+    // btc: account 0 receive 46 + change 23, account 1 receive 21 + change 20, account 2 receive 20 + change 20;
+    // eth: account 0 21 + 20, account 1 20 + 20; xlm: accounts 0, 1, 2
+    EXPECT_EQ(calls, 46 + 23 + 21 + 20 + 20 + 20 + 21 + 20 + 20 + 20 + 3);
+
+    auto key = StoredKey::createWithMnemonic("name", TW::data(string("password")), discoveryMnemonic);
+    for (const auto& account : accounts) {
+        key.addAccount(account.address, account.coin, account.derivationPath, account.extendedPublicKey);
+    }
+    EXPECT_EQ(key.accounts.size(), expected.size());
+    EXPECT_EQ(key.account(eth)->address, "0x9858EfFD232B4033E47d90003D41EC34EcaEda94");
+}
+
+TEST(AccountDiscovery, GapLimitAndMaxAccounts) {
+    const auto wallet = HDWallet(discoveryMnemonic, "");
+    const auto coin = TWCoinTypeLitecoin;
+    const auto used = set<string>{
+        addressAt(wallet, coin, "m/84'/2'/0'/0/4"),
+        addressAt(wallet, coin, "m/84'/2'/1'/0/0"),
+    };
+    const auto isUsed = [&](TWCoinType, const string& address) { return used.count(address) > 0; };
+
+    // 4 is beyond a gap of 3
+    EXPECT_TRUE(AccountDiscovery(3).discover(wallet, {coin}, isUsed).empty());
+    EXPECT_EQ(AccountDiscovery(5).discover(wallet, {coin}, isUsed).size(), 2);
+
+    auto discovery = AccountDiscovery(5);
+    discovery.maxAccounts = 1;
+    const auto accounts = discovery.discover(wallet, {coin}, isUsed);
+    ASSERT_EQ(accounts.size(), 1);
+    EXPECT_EQ(accounts[0].derivationPath.string(), "m/84'/2'/0'/0/4");
+
+    EXPECT_TRUE(AccountDiscovery().discover(wallet, {}, isUsed).empty());
+}
+
+TEST(AccountDiscovery, CallbackException) {
+    const auto wallet = HDWallet(discoveryMnemonic, "");
+    EXPECT_THROW(AccountDiscovery().discover(wallet, {TWCoinTypeBitcoin, TWCoinTypeEthereum}, [](TWCoinType, const string&) -> bool {
+        throw runtime_error("offline");
+    }), runtime_error);
+}
+
+} // namespace TW::Keystore
@@ -0,0 +1,100 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Keystore/WalletGenerator.h"
+
+#include "Coin.h"
+#include "Data.h"
+#include "HDWallet.h"
+#include "HexCoding.h"
+#include "Mnemonic.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+namespace TW::Keystore {
+
+using namespace std;
+
+const auto generatorPassword = TW::data(string("password"));
+
+TEST(WalletGenerator, GenerateOne) {
+    const auto generator = WalletGenerator(128, {TWCoinTypeBitcoin, TWCoinTypeEthereum});
+    const auto key = generator.generateOne(parse_hex("00000000000000000000000000000000"), "name", generatorPassword);
+
+    EXPECT_EQ(key.type, StoredKeyType::mnemonicPhrase);
+    EXPECT_EQ(key.name, "name");
+    EXPECT_EQ(key.wallet(generatorPassword).getMnemonic(), "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about");
+    ASSERT_EQ(key.accounts.size(), 2);
+    EXPECT_EQ(key.accounts[0].coin, TWCoinTypeBitcoin);
+    EXPECT_EQ(key.accounts[0].address, "bc1qcr8te4kr609gcawutmrza0j4xv80jy8z306fyu");
+    EXPECT_EQ(key.accounts[0].extendedPublicKey, "zpub6rFR7y4Q2AijBEqTUquhVz398htDFrtymD9xYYfG1m4wAcvPhXNfE3EfH1r1ADqtfSdVCToUG868RvUUkgDKf31mGDtKsAYz2oz2AGutZYs");
+    EXPECT_EQ(key.accounts[1].coin, TWCoinTypeEthereum);
+    EXPECT_EQ(key.accounts[1].address, "0x9858EfFD232B4033E47d90003D41EC34EcaEda94");
+}
+
+TEST(WalletGenerator, Generate) {
+    auto generator = WalletGenerator(128, {TWCoinTypeBitcoin});
+    generator.chunkSize = 2;
+
+    vector<size_t> indices;
+    set<string> mnemonics;
+    generator.generate(5, "key", generatorPassword, [&](size_t index, StoredKey&& key) {
+        indices.push_back(index);
+        EXPECT_EQ(key.name, "key" + to_string(index));
+
+        const auto wallet = key.wallet(generatorPassword);
+        EXPECT_TRUE(Mnemonic::isValid(wallet.getMnemonic()));
+        EXPECT_EQ(wallet.getEntropy().size(), 16);
+        mnemonics.insert(wallet.getMnemonic());
+
+        ASSERT_EQ(key.accounts.size(), 1);
+        EXPECT_EQ(key.accounts[0].address, wallet.deriveAddress(TWCoinTypeBitcoin));
+    });
+
+    EXPECT_EQ(indices, (vector<size_t>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(mnemonics.size(), 5);
+}
+
+TEST(WalletGenerator, GenerateStrength) {
+    const auto generator = WalletGenerator(256, {});
+    size_t calls = 0;
+    generator.generate(2, "key", generatorPassword, [&](size_t, StoredKey&& key) {
+        ++calls;
+        const auto mnemonic = key.wallet(generatorPassword).getMnemonic();
+        EXPECT_TRUE(Mnemonic::isValid(mnemonic));
+        EXPECT_EQ(count(mnemonic.begin(), mnemonic.end(), ' '), 23);
+        EXPECT_TRUE(key.accounts.empty());
+    });
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(WalletGenerator, GenerateInvalid) {
+    const auto sink = [](size_t, StoredKey&&) { FAIL() << "sink called"; };
+    EXPECT_THROW(WalletGenerator(100, {}).generate(1, "key", generatorPassword, sink), invalid_argument);
+    EXPECT_THROW(WalletGenerator(288, {}).generate(1, "key", generatorPassword, sink), invalid_argument);
+    EXPECT_THROW(WalletGenerator(128, {}).generateOne(Data(15), "key", generatorPassword), invalid_argument);
+
+    // nothing to generate, nothing to validate against
+    WalletGenerator(128, {}).generate(0, "key", generatorPassword, sink);
+}
+
+TEST(WalletGenerator, SinkException) {
+    auto generator = WalletGenerator(128, {});
+    generator.chunkSize = 1;
+    size_t calls = 0;
+    EXPECT_THROW(generator.generate(3, "key", generatorPassword, [&](size_t, StoredKey&&) {
+        if (++calls == 2) {
+            throw runtime_error("sink full");
+        }
+    }), runtime_error);
+    EXPECT_EQ(calls, 2);
+}
+
+} // namespace TW::Keystore
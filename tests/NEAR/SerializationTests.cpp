@@ -40,4 +40,36 @@ TEST(NEARSerialization, SerializeTransferTransaction) {
     ASSERT_EQ(serializedHex, "09000000746573742e6e65617200917b3d268d4b58f7fec1b150bd68d69be3ee5d4cc39855e341538465bb77860d01000000000000000d00000077686174657665722e6e6561720fa473fd26901df296be6adc4cc4df34d040efa2435224b6986910e630c2fef6010000000301000000000000000000000000000000");
 }
 
+TEST(NEARSerialization, SerializeBatchedActions) {
+    auto input = Proto::SigningInput();
+    input.set_signer_id("test.near");
+    input.set_nonce(1);
+    input.set_receiver_id("whatever.near");
+    auto blockHash = Base58::bitcoin.decode("244ZQ9cgj3CQ6bWBdytfrJMuMQ1jdXLFGnr4HhvtCTnM");
+    input.set_block_hash(blockHash.data(), blockHash.size());
+    auto privateKey = Base58::bitcoin.decode("3hoMW1HvnRLSFCLZnvPzWeoGwtdHzke34B2cTHM8rhcbG3TbuLKtShTv3DvyejnXKXKBiV7YPkLeqUHN1ghnqpFv");
+    input.set_private_key(privateKey.data(), 32);
+
+    // a short deposit is zero-padded to 16 bytes
+    const auto deposit = parse_hex("0a");
+    input.add_actions()->mutable_transfer()->set_deposit(deposit.data(), deposit.size());
+    auto& functionCall = *input.add_actions()->mutable_function_call();
+    functionCall.set_method_name("ft_transfer");
+    functionCall.set_args(R"({"a":1})");
+    functionCall.set_gas(30000000000000);
+    const auto callDeposit = parse_hex("01");
+    functionCall.set_deposit(callDeposit.data(), callDeposit.size());
+    input.add_actions()->mutable_create_account();
+
+    const auto serialized = transactionData(input, 65);
+    EXPECT_EQ(hex(serialized),
+              "09000000746573742e6e65617200917b3d268d4b58f7fec1b150bd68d69be3ee5d4cc39855e341538465bb77860d0100000000000000"
+              "0d00000077686174657665722e6e6561720fa473fd26901df296be6adc4cc4df34d040efa2435224b6986910e630c2fef6"
+              "03000000"
+              "03" "0a000000000000000000000000000000"
+              "02" "0b000000" "66745f7472616e73666572" "07000000" "7b2261223a317d" "00e057eb481b0000" "01000000000000000000000000000000"
+              "00");
+    EXPECT_GE(serialized.capacity(), serialized.size() + 65);
+}
+
 }
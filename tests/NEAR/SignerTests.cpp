@@ -7,7 +7,10 @@
 #include "Base64.h"
 #include "Base58.h"
 #include "proto/NEAR.pb.h"
+#include "NEAR/Serialization.h"
 #include "NEAR/Signer.h"
+#include "Hash.h"
+#include "PrivateKey.h"
 
 #include <TrustWalletCore/TWHRP.h>
 #include <gtest/gtest.h>
@@ -43,4 +46,31 @@ TEST(NEARSigner, SignTx) {
     ASSERT_EQ(outputInBase64, "CQAAAHRlc3QubmVhcgCRez0mjUtY9/7BsVC9aNab4+5dTMOYVeNBU4Rlu3eGDQEAAAAAAAAADQAAAHdoYXRldmVyLm5lYXIPpHP9JpAd8pa+atxMxN800EDvokNSJLaYaRDmMML+9gEAAAADAQAAAAAAAAAAAAAAAAAAAACWmoMzIYbul1Xkg5MlUlgG4Ymj0tK7S0dg6URD6X4cTyLe7vAFmo6XExAO2m4ZFE2n6KDvflObIHCLodjQIb0B");
 }
 
+TEST(NEARSigner, SignBatchedTransfers) {
+    auto input = Proto::SigningInput();
+    input.set_signer_id("test.near");
+    input.set_nonce(2);
+    input.set_receiver_id("whatever.near");
+    auto blockHash = Base58::bitcoin.decode("244ZQ9cgj3CQ6bWBdytfrJMuMQ1jdXLFGnr4HhvtCTnM");
+    input.set_block_hash(blockHash.data(), blockHash.size());
+    auto privateKey = Base58::bitcoin.decode("3hoMW1HvnRLSFCLZnvPzWeoGwtdHzke34B2cTHM8rhcbG3TbuLKtShTv3DvyejnXKXKBiV7YPkLeqUHN1ghnqpFv");
+    input.set_private_key(privateKey.data(), 32);
+    for (byte i = 1; i <= 10; ++i) {
+        Data deposit(16, 0);
+        deposit[0] = i;
+        input.add_actions()->mutable_transfer()->set_deposit(deposit.data(), deposit.size());
+    }
+
+    const auto output = Signer::sign(input);
+    const auto transaction = transactionData(input);
+    const auto signedTransaction = data(output.signed_transaction());
+    ASSERT_EQ(signedTransaction.size(), transaction.size() + 1 + 64);
+    EXPECT_TRUE(std::equal(transaction.begin(), transaction.end(), signedTransaction.begin()));
+    EXPECT_EQ(signedTransaction[transaction.size()], 0);
+
+    const auto publicKey = PrivateKey(Data(privateKey.begin(), privateKey.begin() + 32)).getPublicKey(TWPublicKeyTypeED25519);
+    const auto signature = Data(signedTransaction.end() - 64, signedTransaction.end());
+    EXPECT_TRUE(publicKey.verify(signature, Hash::sha256(transaction)));
+}
+
 }
@@ -45,6 +45,18 @@ TEST(NanoSigner, sign1) {
         "\"signature\":\"d247f6b90383b24e612569c75a12f11242f6e03b4914eadc7d941577dcf54a3a7cb7f0a4aba4246a40d9ebb5ee1e00b4a0a834ad5a1e7bef24e11f62b95a9e09\","
         "\"type\":\"state\"}",
         out.json());
+
+    input.set_output_format(Common::Proto::Output_raw);
+    const auto raw = Signer(input).build();
+    EXPECT_EQ(raw.signature(), out.signature());
+    EXPECT_EQ(raw.block_hash(), out.block_hash());
+    EXPECT_TRUE(raw.json().empty());
+
+    input.set_output_format(Common::Proto::Output_json);
+    const auto json = Signer(input).build();
+    EXPECT_TRUE(json.signature().empty());
+    EXPECT_TRUE(json.block_hash().empty());
+    EXPECT_EQ(json.json(), out.json());
 }
 
 TEST(NanoSigner, sign2) {
@@ -78,4 +78,25 @@ TEST(OntologyOng, withdraw) {
         "0ea6435f6f2b1335192a5d1b346fd431e8af912bfa4e1a23ad7d0ab7fc5b808655af5c9043232103d9fd62df33"
         "2403d9114f3fa3da0d5aec9dfa42948c2f50738d52470469a1a1eeac",
         rawTx);
-}
\ No newline at end of file
+}
+
+TEST(OntologyOng, transfers) {
+    auto signer1 = Signer(
+        PrivateKey(parse_hex("4646464646464646464646464646464646464646464646464646464646464646")));
+    auto signer2 = Signer(
+        PrivateKey(parse_hex("4646464646464646464646464646464646464646464646464646464646464652")));
+    const std::vector<std::pair<Address, uint64_t>> recipients = {
+        {Address("Af1n2cZHhMZumNqKgw9sfCNoTWu9de4NDn"), 1},
+        {Address("ANDfjwrUroaVtvBguDtrWKRMyxFwvVwnZD"), 123456789},
+        {Address("Af1n2cZHhMZumNqKgw9sfCNoTWu9de4NDn"), 0},
+    };
+    uint64_t gasPrice = 500, gasLimit = 20000;
+    auto txs = Ong().transfers(signer1, recipients, signer2, gasPrice, gasLimit, 7);
+    ASSERT_EQ(txs.size(), recipients.size());
+    for (size_t i = 0; i < recipients.size(); ++i) {
+        auto expected = Ong().transfer(signer1, recipients[i].first, recipients[i].second, signer2,
+                                        gasPrice, gasLimit, 7 + static_cast<uint32_t>(i));
+        EXPECT_EQ(hex(expected.serialize()), hex(txs[i].serialize())) << i;
+    }
+    EXPECT_TRUE(Ong().transfers(signer1, {}, signer2, gasPrice, gasLimit, 0).empty());
+}
@@ -57,4 +57,25 @@ TEST(OntologyOnt, transfer) {
               "0576d7b092fabafd0913a67ccf8b2f8e3d2bd708f768c2bb67e2d2f759805608232103d9fd62df332403"
               "d9114f3fa3da0d5aec9dfa42948c2f50738d52470469a1a1eeac",
               rawTx);
-}
\ No newline at end of file
+}
+
+TEST(OntologyOnt, transfers) {
+    auto signer1 = Signer(
+        PrivateKey(parse_hex("4646464646464646464646464646464646464646464646464646464646464646")));
+    auto signer2 = Signer(
+        PrivateKey(parse_hex("4646464646464646464646464646464646464646464646464646464646464652")));
+    const std::vector<std::pair<Address, uint64_t>> recipients = {
+        {Address("Af1n2cZHhMZumNqKgw9sfCNoTWu9de4NDn"), 1},
+        {Address("ANDfjwrUroaVtvBguDtrWKRMyxFwvVwnZD"), 123456789},
+        {Address("Af1n2cZHhMZumNqKgw9sfCNoTWu9de4NDn"), 0},
+    };
+    uint64_t gasPrice = 500, gasLimit = 20000;
+    auto txs = Ont().transfers(signer1, recipients, signer2, gasPrice, gasLimit, 7);
+    ASSERT_EQ(txs.size(), recipients.size());
+    for (size_t i = 0; i < recipients.size(); ++i) {
+        auto expected = Ont().transfer(signer1, recipients[i].first, recipients[i].second, signer2,
+                                        gasPrice, gasLimit, 7 + static_cast<uint32_t>(i));
+        EXPECT_EQ(hex(expected.serialize()), hex(txs[i].serialize())) << i;
+    }
+    EXPECT_TRUE(Ont().transfers(signer1, {}, signer2, gasPrice, gasLimit, 0).empty());
+}
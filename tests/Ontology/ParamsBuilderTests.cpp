@@ -9,10 +9,14 @@
 
 #include "Ontology/Address.h"
 #include "Ontology/Ont.h"
+#include "Ontology/Ong.h"
 #include "Ontology/ParamsBuilder.h"
+#include "Ontology/TransferTemplate.h"
 
 #include <gtest/gtest.h>
 
+#include <list>
+
 using namespace TW;
 using namespace TW::Ontology;
 
@@ -81,4 +85,35 @@ TEST(ParamsBuilder, transferInvokeCode) {
         "ad76586a7cc8516a7cc86c51c1087472616e736665721400000000000000000000000000000000000000010068"
         "164f6e746f6c6f67792e4e61746976652e496e766f6b65";
     EXPECT_EQ(hexInvokeCode, hex(invokeCode));
-}
\ No newline at end of file
+}
+
+TEST(ParamsBuilder, transferTemplate) {
+    auto fromAddress = Address("ANDfjwrUroaVtvBguDtrWKRMyxFwvVwnZD").data;
+    auto toAddress = Address("Af1n2cZHhMZumNqKgw9sfCNoTWu9de4NDn").data;
+    const auto ont = TransferTemplate(Ont().contractAddress(), 0x00);
+    EXPECT_EQ(
+        "00c66b1446b1a18af6b7c9f8a4602f9f73eeb3030f0c29b76a7cc814feec06b79ed299ea06fcb94abac41aaf3e"
+        "ad76586a7cc8516a7cc86c51c1087472616e736665721400000000000000000000000000000000000000010068"
+        "164f6e746f6c6f67792e4e61746976652e496e766f6b65",
+        hex(ont.build(fromAddress, toAddress, 1)));
+
+    const auto ong = TransferTemplate(Ong().contractAddress(), 0x00);
+    const std::vector<uint64_t> amounts = {0, 1, 15, 16, 127, 128, 255, 256, 0xFFFF, 0x10000, 0x7FFFFFFF,
+                                           0xFFFFFFFFFF, 0x8000000000000000, UINT64_MAX};
+    for (auto amount : amounts) {
+        std::list<boost::any> transferParam{fromAddress, toAddress, amount};
+        std::vector<boost::any> args{transferParam};
+        EXPECT_EQ(hex(ParamsBuilder::buildNativeInvokeCode(Ong().contractAddress(), 0x00, "transfer", args)),
+                  hex(ong.build(fromAddress, toAddress, amount)))
+            << amount;
+    }
+
+    // appends
+    Data out = {0xff};
+    ong.build(toAddress, fromAddress, 2, out);
+    EXPECT_EQ(out[0], 0xff);
+    std::list<boost::any> transferParam{toAddress, fromAddress, uint64_t(2)};
+    std::vector<boost::any> args{transferParam};
+    EXPECT_EQ(hex(Data(out.begin() + 1, out.end())),
+              hex(ParamsBuilder::buildNativeInvokeCode(Ong().contractAddress(), 0x00, "transfer", args)));
+}
@@ -38,6 +38,10 @@ TEST(PolkadotCodec, EncodeCompact) {
     ASSERT_EQ(hex(encodeCompact(72057594037927936)), "130000000000000001");
     
     ASSERT_EQ(hex(encodeCompact(18446744073709551615u)), "13ffffffffffffffff");
+
+    // beyond 64 bits
+    ASSERT_EQ(hex(encodeCompact(CompactInteger(1) << 64)), "17000000000000000001");
+    ASSERT_EQ(hex(encodeCompact(CompactInteger(1073741824))), "0300000040");
 }
 
 TEST(PolkadotCodec, EncodeBool) {
@@ -92,6 +92,41 @@ TEST(PublicKeyTests, CompressedExtended) {
     EXPECT_EQ(compressed2.isCompressed(), true);
 }
 
+TEST(PublicKeyTests, CompressedExtendedCached) {
+    const auto compressedHex = "0399c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c1";
+    const auto extendedHex = "0499c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c166b489a4b7c491e7688e6ebea3a71fc3a1a48d60f98d5ce84c93b65e423fde91";
+
+    // decompressed once, then served to copies and round trips
+    const auto publicKey = PublicKey(parse_hex(compressedHex), TWPublicKeyTypeSECP256k1);
+    EXPECT_EQ(hex(publicKey.extended().bytes), extendedHex);
+    EXPECT_EQ(hex(publicKey.extended().bytes), extendedHex);
+    const auto copy = publicKey;
+    EXPECT_EQ(hex(copy.extended().bytes), extendedHex);
+    EXPECT_EQ(hex(publicKey.extended().compressed().extended().bytes), extendedHex);
+
+    // a stale cache is not used after the bytes change
+    const auto otherCompressedHex = "02a1633cafcc01ebfb6d78e39f687a1f0995c62fc95f51ead10a02ee0be551b5dc";
+    auto changed = publicKey;
+    changed.bytes = parse_hex(otherCompressedHex);
+    EXPECT_EQ(hex(changed.extended().bytes), hex(PublicKey(parse_hex(otherCompressedHex), TWPublicKeyTypeSECP256k1).extended().bytes));
+    EXPECT_EQ(hex(changed.extended().compressed().bytes), otherCompressedHex);
+    EXPECT_EQ(hex(publicKey.extended().bytes), extendedHex);
+
+    // keys from a private key come with both encodings
+    const auto privateKey = PrivateKey(parse_hex("afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5"));
+    EXPECT_EQ(hex(privateKey.getPublicKey(TWPublicKeyTypeSECP256k1).extended().bytes), extendedHex);
+    EXPECT_EQ(hex(privateKey.getPublicKey(TWPublicKeyTypeSECP256k1Extended).compressed().bytes), compressedHex);
+    const auto nist = privateKey.getPublicKey(TWPublicKeyTypeNIST256p1Extended);
+    EXPECT_EQ(nist.compressed().extended(), nist);
+    EXPECT_EQ(nist.compressed(), privateKey.getPublicKey(TWPublicKeyTypeNIST256p1));
+}
+
+TEST(PublicKeyTests, ExtendedInvalidPoint) {
+    // x = 5 is not on secp256k1
+    const auto publicKey = PublicKey(parse_hex("020000000000000000000000000000000000000000000000000000000000000005"), TWPublicKeyTypeSECP256k1);
+    EXPECT_THROW(publicKey.extended(), std::invalid_argument);
+}
+
 TEST(PublicKeyTests, CompressedExtendedNist) {
     const Data key = parse_hex("afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5");
     auto privateKey = PrivateKey(key);
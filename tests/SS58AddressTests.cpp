@@ -0,0 +1,60 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "SS58Address.h"
+#include "Hash.h"
+#include "HexCoding.h"
+
+#include <TrustWalletCore/TWSS58AddressType.h>
+#include <gtest/gtest.h>
+
+using namespace TW;
+
+TEST(SS58Address, Checksum) {
+    const auto data = parse_hex("00beff0e5d6f6e6e6d573d3044f3e2bfb353400375dc281da3337468d4aa527908");
+    auto prefixed = Data(SS58Prefix.begin(), SS58Prefix.end());
+    append(prefixed, data);
+    const auto hash = Hash::blake2b(prefixed, 64);
+
+    const auto checksum = SS58Address::checksum(data.data(), data.size());
+    EXPECT_EQ(hex(checksum), hex(Data(hash.begin(), hash.begin() + 2)));
+    EXPECT_EQ(hex(SS58Address::computeChecksum(data)), hex(checksum));
+    // the cached prefix state is not modified by use
+    EXPECT_EQ(hex(SS58Address::checksum(data.data(), data.size())), hex(checksum));
+}
+
+TEST(SS58Address, Decode) {
+    std::array<byte, SS58Address::size> bytes;
+    ASSERT_TRUE(SS58Address::decode("15KRsCq9LLNmCxNFhGk55s5bEyazKefunDxUH24GFZwsTxyu", TWSS58AddressTypePolkadot, bytes));
+    EXPECT_EQ(hex(bytes), "00beff0e5d6f6e6e6d573d3044f3e2bfb353400375dc281da3337468d4aa527908");
+
+    // wrong network
+    EXPECT_FALSE(SS58Address::decode("15KRsCq9LLNmCxNFhGk55s5bEyazKefunDxUH24GFZwsTxyu", TWSS58AddressTypeKusama, bytes));
+    // wrong checksum
+    EXPECT_FALSE(SS58Address::decode("15KRsCq9LLNmCxNFhGk55s5bEyazKefunDxUH24GFZwsTxyv", TWSS58AddressTypePolkadot, bytes));
+    // wrong length
+    EXPECT_FALSE(SS58Address::decode("1ES14c7qLb5CYhLMUekctxLgc1FV2Ti9DA", TWSS58AddressTypePolkadot, bytes));
+    EXPECT_FALSE(SS58Address::decode("", TWSS58AddressTypePolkadot, bytes));
+}
+
+TEST(SS58Address, Validate) {
+    const auto strings = std::vector<std::string>{
+        "15KRsCq9LLNmCxNFhGk55s5bEyazKefunDxUH24GFZwsTxyu",
+        "FHKAe66mnbk8ke8zVWE9hFVFrJN1mprFPVmD5rrevotkcDZ",
+        "15AeCjMpcSt3Fwa47jJBd7JzQ395Kr2cuyF5Zp4UBf1g9ony",
+        "5FqqU2rytGPhcwQosKRtW1E3ha6BJKAjHgtcodh71dSyXhoZ",
+        "",
+    };
+    EXPECT_EQ(SS58Address::validate(strings, TWSS58AddressTypePolkadot), (std::vector<bool>{true, false, true, false, false}));
+    EXPECT_EQ(SS58Address::validate(strings, TWSS58AddressTypeKusama), (std::vector<bool>{false, true, false, false, false}));
+    EXPECT_TRUE(SS58Address::validate({}, TWSS58AddressTypePolkadot).empty());
+}
+
+TEST(SS58Address, RoundTrip) {
+    const auto address = SS58Address("FHKAe66mnbk8ke8zVWE9hFVFrJN1mprFPVmD5rrevotkcDZ", TWSS58AddressTypeKusama);
+    EXPECT_EQ(address.string(), "FHKAe66mnbk8ke8zVWE9hFVFrJN1mprFPVmD5rrevotkcDZ");
+    EXPECT_THROW(SS58Address("FHKAe66mnbk8ke8zVWE9hFVFrJN1mprFPVmD5rrevotkcDZ", TWSS58AddressTypePolkadot), std::invalid_argument);
+}
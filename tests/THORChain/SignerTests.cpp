@@ -6,6 +6,8 @@
 
 #include "proto/Cosmos.pb.h"
 #include "THORChain/Signer.h"
+#include "Cosmos/Protobuf/thorchain_bank_tx.pb.h"
+#include "Cosmos/Protobuf/tx.pb.h"
 #include "HexCoding.h"
 
 #include <gtest/gtest.h>
@@ -53,3 +55,65 @@ TEST(THORChainSigner, SignJson) {
 
     EXPECT_EQ(R"({"mode":"block","tx":{"fee":{"amount":[{"amount":"200","denom":"rune"}],"gas":"2000000"},"memo":"memo1234","msg":[{"type":"thorchain/MsgSend","value":{"amount":[{"amount":"50000000","denom":"rune"}],"from_address":"thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r","to_address":"thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn"}}],"signatures":[{"pub_key":{"type":"tendermint/PubKeySecp256k1","value":"A+2Zfjls9CkvX85aQrukFZnM1dluMTFUp8nqcEneMXx3"},"signature":"12AaNC0v51Rhz8rBf7V7rpI6oksREWrjzba3RK1v1NNlqZq62sG0aXWvStp9zZXe07Pp2FviFBAx+uqWsO30NQ=="}]}})", outputJson);
 }
+
+TEST(THORChainSigner, SignTxProtobuf) {
+    auto input = Cosmos::Proto::SigningInput();
+    input.set_signing_mode(Cosmos::Proto::Protobuf);
+    input.set_chain_id("thorchain");
+    input.set_account_number(593);
+    input.set_sequence(21);
+    input.set_memo("");
+
+    auto msg = input.add_messages();
+    auto& message = *msg->mutable_send_coins_message();
+    message.set_from_address("thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r");
+    message.set_to_address("thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn");
+    auto amountOfTx = message.add_amounts();
+    amountOfTx->set_denom("rune");
+    amountOfTx->set_amount(300000000);
+
+    auto& fee = *input.mutable_fee();
+    fee.set_gas(2000000);
+
+    auto privateKey = parse_hex("7105512f0c020a1dd759e14b865ec0125f59ac31e34d7a2807a228ed50cb343e");
+    input.set_private_key(privateKey.data(), privateKey.size());
+
+    auto output = THORChain::Signer::sign(input);
+
+    EXPECT_EQ(output.error(), Common::Proto::OK);
+    EXPECT_EQ(hex(output.signature()), "23f731c210076cea23162baf1424a5959be4ba024b8c88c30995602e5299e42930e0838fe999974263215fa5666d9e40def0c11946fac37ee449d80849a26acb");
+    EXPECT_EQ(hex(output.serialized()), "0a530a510a0e2f74797065732e4d736753656e64123f0a141522e767db6eb19708b0038029bfbd607bc9bd0e1214ca86459fb00551c7df42540c5e7869192c833adb1a110a0472756e65120933303030303030303012580a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a2103ed997e396cf4292f5fce5a42bba41599ccd5d96e313154a7c9ea7049de317c7712040a020801181512041080897a1a4023f731c210076cea23162baf1424a5959be4ba024b8c88c30995602e5299e42930e0838fe999974263215fa5666d9e40def0c11946fac37ee449d80849a26acb");
+
+    // THORChain's MsgSend carries the raw account bytes, not bech32 strings
+    auto txRaw = cosmos::tx::v1beta1::TxRaw();
+    ASSERT_TRUE(txRaw.ParseFromString(output.serialized()));
+    auto body = cosmos::tx::v1beta1::TxBody();
+    ASSERT_TRUE(body.ParseFromString(txRaw.body_bytes()));
+    ASSERT_EQ(body.messages_size(), 1);
+    EXPECT_EQ(body.messages(0).type_url(), "/types.MsgSend");
+    auto msgSend = types::MsgSend();
+    ASSERT_TRUE(body.messages(0).UnpackTo(&msgSend));
+    EXPECT_EQ(hex(msgSend.from_address()), "1522e767db6eb19708b0038029bfbd607bc9bd0e");
+    EXPECT_EQ(hex(msgSend.to_address()), "ca86459fb00551c7df42540c5e7869192c833adb");
+}
+
+TEST(THORChainSigner, SignTxProtobufForeignHrp) {
+    auto input = Cosmos::Proto::SigningInput();
+    input.set_signing_mode(Cosmos::Proto::Protobuf);
+    input.set_chain_id("thorchain");
+
+    auto& message = *input.add_messages()->mutable_send_coins_message();
+    message.set_from_address("thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r");
+    message.set_to_address("cosmos1zt50azupanqlfam5afhv3hexwyutnukeh4c573");
+    auto amountOfTx = message.add_amounts();
+    amountOfTx->set_denom("rune");
+    amountOfTx->set_amount(300000000);
+
+    auto privateKey = parse_hex("7105512f0c020a1dd759e14b865ec0125f59ac31e34d7a2807a228ed50cb343e");
+    input.set_private_key(privateKey.data(), privateKey.size());
+
+    auto output = THORChain::Signer::sign(input);
+
+    EXPECT_EQ(output.error(), Common::Proto::Error_invalid_address);
+    EXPECT_EQ(output.serialized(), "");
+}
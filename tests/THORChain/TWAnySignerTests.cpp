@@ -47,3 +47,45 @@ TEST(THORChainTWAnySigner, SignTx) {
     // https://viewblock.io/thorchain/tx/FD0445AFFC4ED9ACCB7B5D3ADE361DAE4596EA096340F1360F1020381EA454AF
     ASSERT_EQ(output.json(), R"({"mode":"block","tx":{"fee":{"amount":[{"amount":"2000000","denom":"rune"}],"gas":"200000"},"memo":"","msg":[{"type":"thorchain/MsgSend","value":{"amount":[{"amount":"10000000","denom":"rune"}],"from_address":"thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r","to_address":"thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn"}}],"signatures":[{"pub_key":{"type":"tendermint/PubKeySecp256k1","value":"A+2Zfjls9CkvX85aQrukFZnM1dluMTFUp8nqcEneMXx3"},"signature":"qgpMX3WNq4DsNBnYtdmBD4ejiailK4uI/m3/YVqCSNF8AtkUOTmP48ztqCbpkWTFvw1/9S8/ivsFxOcK6AI0jA=="}]}})");
 }
+
+TEST(THORChainTWAnySigner, SignTxProtobuf) {
+    auto privateKey = parse_hex("7105512f0c020a1dd759e14b865ec0125f59ac31e34d7a2807a228ed50cb343e");
+    Cosmos::Proto::SigningInput input;
+    input.set_signing_mode(Cosmos::Proto::Protobuf);
+    input.set_chain_id("thorchain");
+    input.set_account_number(593);
+    input.set_sequence(21);
+    input.set_memo("");
+    input.set_private_key(privateKey.data(), privateKey.size());
+
+    auto msg = input.add_messages();
+    auto& message = *msg->mutable_send_coins_message();
+    message.set_from_address("thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r");
+    message.set_to_address("thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn");
+    auto amountOfTx = message.add_amounts();
+    amountOfTx->set_denom("rune");
+    amountOfTx->set_amount(300000000);
+
+    auto& fee = *input.mutable_fee();
+    fee.set_gas(2000000);
+
+    {
+        Cosmos::Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeTHORChain);
+
+        EXPECT_EQ(output.error(), Common::Proto::OK);
+        EXPECT_EQ(hex(output.signature()), "23f731c210076cea23162baf1424a5959be4ba024b8c88c30995602e5299e42930e0838fe999974263215fa5666d9e40def0c11946fac37ee449d80849a26acb");
+        EXPECT_EQ(hex(output.serialized()), "0a530a510a0e2f74797065732e4d736753656e64123f0a141522e767db6eb19708b0038029bfbd607bc9bd0e1214ca86459fb00551c7df42540c5e7869192c833adb1a110a0472756e65120933303030303030303012580a500a460a1f2f636f736d6f732e63727970746f2e736563703235366b312e5075624b657912230a2103ed997e396cf4292f5fce5a42bba41599ccd5d96e313154a7c9ea7049de317c7712040a020801181512041080897a1a4023f731c210076cea23162baf1424a5959be4ba024b8c88c30995602e5299e42930e0838fe999974263215fa5666d9e40def0c11946fac37ee449d80849a26acb");
+    }
+
+    auto& raw = *input.add_messages()->mutable_raw_json_message();
+    raw.set_type("thorchain/MsgSend");
+    raw.set_value("{}");
+    {
+        Cosmos::Proto::SigningOutput output;
+        ANY_SIGN(input, TWCoinTypeTHORChain);
+
+        EXPECT_EQ(output.error(), Common::Proto::Error_general);
+        EXPECT_EQ(output.serialized(), "");
+    }
+}
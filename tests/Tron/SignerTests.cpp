@@ -46,6 +46,20 @@ TEST(TronSigner, SignTransferAsset) {
 
     ASSERT_EQ(hex(output.id()), "546a3d07164c624809cf4e564a083a7a7974bb3c4eff6bb3e278b0ca21083fcb");
     ASSERT_EQ(hex(output.signature()), "77f5eabde31e739d34a66914540f1756981dc7d782c9656f5e14e53b59a15371603a183aa12124adeee7991bf55acc8e488a6ca04fb393b1a8ac16610eeafdfc00");
+
+    input.set_output_format(Common::Proto::Output_raw);
+    const auto raw = Signer::sign(input);
+    EXPECT_EQ(raw.id(), output.id());
+    EXPECT_EQ(raw.signature(), output.signature());
+    EXPECT_EQ(raw.ref_block_bytes(), output.ref_block_bytes());
+    EXPECT_EQ(raw.ref_block_hash(), output.ref_block_hash());
+    EXPECT_TRUE(raw.json().empty());
+
+    input.set_output_format(Common::Proto::Output_json);
+    const auto json = Signer::sign(input);
+    EXPECT_TRUE(json.id().empty());
+    EXPECT_TRUE(json.signature().empty());
+    EXPECT_EQ(json.json(), output.json());
 }
 
 TEST(TronSigner, SignTransfer) {
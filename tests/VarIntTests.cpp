@@ -0,0 +1,135 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "VarInt.h"
+#include "HexCoding.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace TW;
+using namespace TW::VarInt;
+
+namespace {
+
+const uint64_t maxValue = std::numeric_limits<uint64_t>::max();
+
+template <typename Append>
+std::string encoded(uint64_t value, Append append) {
+    Data data;
+    append(value, data);
+    return hex(data);
+}
+
+/// Decodes every prefix of the encoding; only the full encoding may succeed.
+template <typename Read>
+void expectRoundTrip(const std::string& encoding, uint64_t expected, Read read) {
+    const auto data = parse_hex("aa" + encoding);
+    for (size_t size = 1; size < data.size(); ++size) {
+        size_t index = 1;
+        uint64_t value = 0;
+        EXPECT_FALSE(read(data.data(), size, index, value)) << encoding << " size " << size;
+        EXPECT_EQ(index, 1);
+    }
+    size_t index = 1;
+    uint64_t value = 0;
+    ASSERT_TRUE(read(data.data(), data.size(), index, value)) << encoding;
+    EXPECT_EQ(index, data.size());
+    EXPECT_EQ(value, expected);
+}
+
+} // namespace
+
+TEST(VarInt, BitLength) {
+    EXPECT_EQ(bitLength(0), 0);
+    EXPECT_EQ(bitLength(1), 1);
+    EXPECT_EQ(bitLength(0x80), 8);
+    EXPECT_EQ(bitLength(maxValue), 64);
+}
+
+TEST(VarInt, CompactSize) {
+    const auto vectors = std::vector<std::pair<uint64_t, std::string>>{
+        {0, "00"},
+        {0xfc, "fc"},
+        {0xfd, "fdfd00"},
+        {0xffff, "fdffff"},
+        {0x10000, "fe00000100"},
+        {0xffffffff, "feffffffff"},
+        {0x100000000, "ff0000000001000000"},
+        {maxValue, "ffffffffffffffffff"},
+    };
+    for (const auto& [value, encoding] : vectors) {
+        EXPECT_EQ(encoded(value, appendCompactSize), encoding);
+        EXPECT_EQ(compactSizeLength(value), encoding.size() / 2);
+        expectRoundTrip(encoding, value, readCompactSize);
+    }
+}
+
+TEST(VarInt, LEB128) {
+    const auto vectors = std::vector<std::pair<uint64_t, std::string>>{
+        {0, "00"},
+        {1, "01"},
+        {0x7f, "7f"},
+        {0x80, "8001"},
+        {300, "ac02"},
+        {0x3fff, "ff7f"},
+        {0x4000, "808001"},
+        {maxValue, "ffffffffffffffffff01"},
+    };
+    for (const auto& [value, encoding] : vectors) {
+        EXPECT_EQ(encoded(value, appendLEB128), encoding);
+        EXPECT_EQ(leb128Length(value), encoding.size() / 2);
+        expectRoundTrip(encoding, value, readLEB128);
+    }
+}
+
+TEST(VarInt, LEB128Overflow) {
+    size_t index = 0;
+    uint64_t value = 0;
+    // 65th bit
+    const auto tooBig = parse_hex("ffffffffffffffffff02");
+    EXPECT_FALSE(readLEB128(tooBig.data(), tooBig.size(), index, value));
+    // more than ten bytes
+    const auto tooLong = parse_hex("8080808080808080808000");
+    EXPECT_FALSE(readLEB128(tooLong.data(), tooLong.size(), index, value));
+    EXPECT_EQ(index, 0);
+}
+
+TEST(VarInt, BigEndian) {
+    EXPECT_EQ(encoded(0, appendBigEndian), "00");
+    EXPECT_EQ(encoded(0xff, appendBigEndian), "ff");
+    EXPECT_EQ(encoded(0x100, appendBigEndian), "0100");
+    EXPECT_EQ(encoded(0xa987654321, appendBigEndian), "a987654321");
+    EXPECT_EQ(encoded(maxValue, appendBigEndian), "ffffffffffffffff");
+    EXPECT_EQ(bigEndianLength(0x10000), 3);
+}
+
+TEST(VarInt, ScaleCompact) {
+    const auto vectors = std::vector<std::pair<uint64_t, std::string>>{
+        {0, "00"},
+        {63, "fc"},
+        {64, "0101"},
+        {16383, "fdff"},
+        {16384, "02000100"},
+        {1073741823, "feffffff"},
+        {1073741824, "0300000040"},
+        {4294967296, "070000000001"},
+        {72057594037927936, "130000000000000001"},
+        {maxValue, "13ffffffffffffffff"},
+    };
+    for (const auto& [value, encoding] : vectors) {
+        EXPECT_EQ(encoded(value, appendScaleCompact), encoding);
+        EXPECT_EQ(scaleCompactLength(value), encoding.size() / 2);
+        expectRoundTrip(encoding, value, readScaleCompact);
+    }
+
+    // nine value bytes do not fit
+    const auto tooBig = parse_hex("17000000000000000001");
+    size_t index = 0;
+    uint64_t value = 0;
+    EXPECT_FALSE(readScaleCompact(tooBig.data(), tooBig.size(), index, value));
+}
@@ -32,4 +32,16 @@ TEST(TWAnySignerWaves, Sign) {
     ANY_SIGN(input, TWCoinTypeWaves);
 
     ASSERT_EQ(hex(output.signature()), "5d6a77b1fd9b53d9735cd2543ba94215664f2b07d6c7befb081221fcd49f5b6ad6b9ac108582e8d3e74943bdf35fd80d985edf4b4de1fb1c5c427e84d0879f8f");
+    const auto json = output.json();
+    EXPECT_FALSE(json.empty());
+
+    input.set_output_format(Common::Proto::Output_raw);
+    ANY_SIGN(input, TWCoinTypeWaves);
+    EXPECT_EQ(hex(output.signature()), "5d6a77b1fd9b53d9735cd2543ba94215664f2b07d6c7befb081221fcd49f5b6ad6b9ac108582e8d3e74943bdf35fd80d985edf4b4de1fb1c5c427e84d0879f8f");
+    EXPECT_TRUE(output.json().empty());
+
+    input.set_output_format(Common::Proto::Output_json);
+    ANY_SIGN(input, TWCoinTypeWaves);
+    EXPECT_TRUE(output.signature().empty());
+    EXPECT_EQ(output.json(), json);
 }
@@ -75,6 +75,16 @@ TEST(ZilliqaSigner, Signing) {
 
     ASSERT_EQ(hex(output.signature().begin(), output.signature().end()), "001fa4df08c11a4a79e96e69399ee48eeecc78231a78b0355a8ca783c77c139436e37934fecc2252ed8dac00e235e22d18410461fb896685c4270642738ed268");
     ASSERT_EQ(output.json(), R"({"amount":"1000000000000","code":"","data":"","gasLimit":"1","gasPrice":"1000000000","nonce":2,"pubKey":"03fb30b196ce3e976593ecc2da220dca9cdea8c84d2373770042a930b892ac0f5c","signature":"001fa4df08c11a4a79e96e69399ee48eeecc78231a78b0355a8ca783c77c139436e37934fecc2252ed8dac00e235e22d18410461fb896685c4270642738ed268","toAddr":"7FCcaCf066a5F26Ee3AFfc2ED1FA9810Deaa632C","version":65537})");
+
+    input.set_output_format(Common::Proto::Output_raw);
+    const auto raw = Signer::sign(input);
+    EXPECT_EQ(raw.signature(), output.signature());
+    EXPECT_TRUE(raw.json().empty());
+
+    input.set_output_format(Common::Proto::Output_json);
+    const auto json = Signer::sign(input);
+    EXPECT_TRUE(json.signature().empty());
+    EXPECT_EQ(json.json(), output.json());
 }
 
 TEST(ZilliqaSigner, SigningData) {
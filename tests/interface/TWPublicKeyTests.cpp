@@ -67,6 +67,14 @@ TEST(TWPublicKeyTests, CompressedExtended) {
     EXPECT_TRUE(TWPublicKeyIsValid(compressed.get(), TWPublicKeyTypeSECP256k1));
 }
 
+TEST(TWPublicKeyTests, UncompressedInvalidPoint) {
+    // x = 5 is not on secp256k1
+    const auto data = DATA("020000000000000000000000000000000000000000000000000000000000000005");
+    const auto publicKey = WRAP(TWPublicKey, TWPublicKeyCreateWithData(data.get(), TWPublicKeyTypeSECP256k1));
+    ASSERT_NE(publicKey.get(), nullptr);
+    EXPECT_EQ(TWPublicKeyUncompressed(publicKey.get()), nullptr);
+}
+
 TEST(TWPublicKeyTests, Verify) {
     const PrivateKey key(parse_hex("afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5"));
     const auto privateKey = WRAP(TWPrivateKey, new TWPrivateKey{ key });
@@ -23,35 +23,208 @@
 
 #include <TrezorCrypto/rand.h>
 
+#include <TrezorCrypto/chacha20poly1305/ecrypt-sync.h>
+#include <TrezorCrypto/memzero.h>
+
+#include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
-#include <sys/uio.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#if defined(__APPLE__)
+#include <sys/random.h>
+#endif
 
 // [wallet-core]
-uint32_t __attribute__((weak)) random32() {
-    int randomData = open("/dev/urandom", O_RDONLY);
-    if (randomData < 0) {
-        return 0;
+// random32() and random_buffer() are served from a per-thread ChaCha20
+// generator with a 256-bit key, seeded with 320 bits from the operating system,
+// instead of opening and reading /dev/urandom on every call. (chacha_drbg.c is
+// not used: its 128-bit key would cap the entropy of 256-bit private keys.)
+// Every call to the cipher produces the next key and nonce along with the
+// output, so the key that produced a block is gone once the block exists
+// ("fast key erasure"). The generator reseeds from the OS every
+// RAND_RESEED_INTERVAL blocks and in a child after fork(), wipes bytes from its
+// buffer as soon as they are handed out, and wipes its state at thread exit.
+// A child created with vfork() or a raw clone() system call bypasses the
+// pthread_atfork handler and shares the parent's stream until its next reseed;
+// such children must not draw random bytes before calling exec.
+// Both functions stay weak so that applications can install their own source.
+
+#define RAND_KEY_LENGTH 32
+#define RAND_IV_LENGTH 8
+#define RAND_SEED_LENGTH (RAND_KEY_LENGTH + RAND_IV_LENGTH)
+// Keystream per cipher call: four ChaCha blocks, the next key and nonce first.
+#define RAND_STREAM_SIZE 256
+// Bytes of output per cipher call.
+#define RAND_BLOCK_SIZE (RAND_STREAM_SIZE - RAND_SEED_LENGTH)
+// Cipher calls between reseeds from the OS (about 216 KiB of output).
+#define RAND_RESEED_INTERVAL 1024
+
+typedef struct {
+  ECRYPT_ctx chacha;
+  uint8_t buffer[RAND_BLOCK_SIZE];
+  // unread bytes at the end of buffer
+  size_t available;
+  // cipher calls since the last reseed
+  uint32_t blocks;
+  // value of rand_fork_generation when the state was last seeded
+  uint32_t generation;
+  int seeded;
+} rand_state;
+
+static _Thread_local rand_state rand_thread_state;
+static uint32_t rand_fork_generation = 0;
+static pthread_once_t rand_once = PTHREAD_ONCE_INIT;
+static pthread_key_t rand_exit_key;
+
+static void rand_atfork_child(void) {
+  // The child inherits the parent's state; make every thread state stale
+  __atomic_add_fetch(&rand_fork_generation, 1, __ATOMIC_RELAXED);
+}
+
+static void rand_thread_exit(void *state) {
+  memzero(state, sizeof(rand_state));
+}
+
+static void rand_init_once(void) {
+  pthread_atfork(NULL, NULL, rand_atfork_child);
+  pthread_key_create(&rand_exit_key, rand_thread_exit);
+}
+
+static int rand_os_urandom(uint8_t *buf, size_t len) {
+  int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return -1;
+  }
+  while (len > 0) {
+    ssize_t n = read(fd, buf, len);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      close(fd);
+      return -1;
     }
+    buf += n;
+    len -= (size_t)n;
+  }
+  close(fd);
+  return 0;
+}
 
-    uint32_t result;
-    if (read(randomData, &result, sizeof(result)) < 0) {
-        return 0;
+static int rand_os_entropy(uint8_t *buf, size_t len) {
+#if defined(__linux__) && defined(SYS_getrandom)
+  while (len > 0) {
+    long n = syscall(SYS_getrandom, buf, len, 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
     }
+    if (n < 0 && errno == ENOSYS) {
+      // kernels older than 3.17
+      return rand_os_urandom(buf, len);
+    }
+    if (n <= 0) {
+      return -1;
+    }
+    buf += n;
+    len -= (size_t)n;
+  }
+  return 0;
+#elif defined(__APPLE__)
+  while (len > 0) {
+    // getentropy is limited to 256 bytes per call
+    size_t chunk = len < 256 ? len : 256;
+    if (getentropy(buf, chunk) != 0) {
+      return -1;
+    }
+    buf += chunk;
+    len -= chunk;
+  }
+  return 0;
+#else
+  return rand_os_urandom(buf, len);
+#endif
+}
+
+static void rand_set_key(rand_state *s, const uint8_t seed[RAND_SEED_LENGTH]) {
+  ECRYPT_keysetup(&s->chacha, seed, RAND_KEY_LENGTH * 8, RAND_IV_LENGTH * 8);
+  ECRYPT_ivsetup(&s->chacha, seed + RAND_KEY_LENGTH);
+}
 
-    close(randomData);
+static void rand_seed(rand_state *s) {
+  uint8_t seed[RAND_SEED_LENGTH];
+  if (rand_os_entropy(seed, sizeof(seed)) != 0) {
+    // never hand out predictable bytes
+    abort();
+  }
+  if (s->seeded) {
+    // mix the fresh entropy into the current state
+    ECRYPT_encrypt_bytes(&s->chacha, seed, seed, sizeof(seed));
+  } else {
+    pthread_setspecific(rand_exit_key, s);
+  }
+  rand_set_key(s, seed);
+  memzero(seed, sizeof(seed));
+  memzero(s->buffer, sizeof(s->buffer));
+  s->available = 0;
+  s->blocks = 0;
+  s->generation = __atomic_load_n(&rand_fork_generation, __ATOMIC_RELAXED);
+  s->seeded = 1;
+}
+
+static void rand_generate(rand_state *s, uint8_t *out) {
+  if (s->blocks >= RAND_RESEED_INTERVAL) {
+    rand_seed(s);
+  }
+  uint8_t stream[RAND_STREAM_SIZE];
+  ECRYPT_keystream_bytes(&s->chacha, stream, sizeof(stream));
+  rand_set_key(s, stream);
+  memcpy(out, stream + RAND_SEED_LENGTH, RAND_BLOCK_SIZE);
+  memzero(stream, sizeof(stream));
+  s->blocks++;
+}
 
-    return result;
+static rand_state *rand_get_state(void) {
+  pthread_once(&rand_once, rand_init_once);
+  rand_state *s = &rand_thread_state;
+  if (!s->seeded ||
+      s->generation != __atomic_load_n(&rand_fork_generation, __ATOMIC_RELAXED)) {
+    rand_seed(s);
+  }
+  return s;
+}
+
+uint32_t __attribute__((weak)) random32(void) {
+  uint32_t result = 0;
+  random_buffer((uint8_t *)&result, sizeof(result));
+  return result;
 }
 
 void __attribute__((weak)) random_buffer(uint8_t *buf, size_t len) {
-    int randomData = open("/dev/urandom", O_RDONLY);
-    if (randomData < 0) {
-        return;
-    }
-    if (read(randomData, buf, len) < 0) {
-        return;
+  rand_state *s = rand_get_state();
+  while (len > 0) {
+    if (s->available == 0) {
+      if (len >= RAND_BLOCK_SIZE) {
+        // large requests bypass the buffer
+        rand_generate(s, buf);
+        buf += RAND_BLOCK_SIZE;
+        len -= RAND_BLOCK_SIZE;
+        continue;
+      }
+      rand_generate(s, s->buffer);
+      s->available = RAND_BLOCK_SIZE;
     }
-    close(randomData);
+    size_t n = len < s->available ? len : s->available;
+    uint8_t *src = s->buffer + (RAND_BLOCK_SIZE - s->available);
+    memcpy(buf, src, n);
+    memzero(src, n);
+    s->available -= n;
+    buf += n;
+    len -= n;
+  }
 }
@@ -28,6 +28,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <TrezorCrypto/check_mem.h>
 
@@ -4718,6 +4721,74 @@ START_TEST(test_chacha_drbg) {
 }
 END_TEST
 
+START_TEST(test_random_buffer) {
+  uint8_t a[1000], b[1000];
+  random_buffer(a, sizeof(a));
+  random_buffer(b, sizeof(b));
+  ck_assert_mem_ne(a, b, sizeof(a));
+
+  // every request size, so that requests straddle the internal buffer
+  for (size_t len = 1; len <= 400; len++) {
+    memset(a, 0, sizeof(a));
+    random_buffer(a, len);
+    size_t zeros = 0;
+    for (size_t i = 0; i < len; i++) {
+      zeros += a[i] == 0;
+    }
+    ck_assert_uint_le(zeros, len / 16 + 4);
+  }
+
+  ck_assert_uint_ne(random32(), random32());
+}
+END_TEST
+
+START_TEST(test_random_buffer_fork) {
+  uint8_t parent[32], child[32];
+  int fds[2];
+  // make sure the parent state is seeded and buffered before forking
+  random_buffer(parent, 1);
+  ck_assert_int_eq(pipe(fds), 0);
+
+  pid_t pid = fork();
+  ck_assert_int_ge(pid, 0);
+  if (pid == 0) {
+    random_buffer(child, sizeof(child));
+    ssize_t written = write(fds[1], child, sizeof(child));
+    _exit(written == sizeof(child) ? 0 : 1);
+  }
+  random_buffer(parent, sizeof(parent));
+  ck_assert_int_eq(read(fds[0], child, sizeof(child)), sizeof(child));
+  int status = 0;
+  waitpid(pid, &status, 0);
+  close(fds[0]);
+  close(fds[1]);
+  ck_assert_mem_ne(parent, child, sizeof(parent));
+}
+END_TEST
+
+static void *random_buffer_thread(void *out) {
+  random_buffer(out, 32);
+  return NULL;
+}
+
+START_TEST(test_random_buffer_threads) {
+  uint8_t outputs[4][32];
+  random_buffer(outputs[0], sizeof(outputs[0]));
+  // each thread seeds its own state, and wipes it when it exits
+  for (int i = 1; i < 4; i++) {
+    pthread_t thread;
+    ck_assert_int_eq(
+        pthread_create(&thread, NULL, random_buffer_thread, outputs[i]), 0);
+    ck_assert_int_eq(pthread_join(thread, NULL), 0);
+  }
+  for (int i = 0; i < 4; i++) {
+    for (int j = i + 1; j < 4; j++) {
+      ck_assert_mem_ne(outputs[i], outputs[j], sizeof(outputs[i]));
+    }
+  }
+}
+END_TEST
+
 START_TEST(test_pbkdf2_hmac_sha256) {
   uint8_t k[64];
 
@@ -9131,6 +9202,12 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_chacha_drbg);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("rand");
+  tcase_add_test(tc, test_random_buffer);
+  tcase_add_test(tc, test_random_buffer_fork);
+  tcase_add_test(tc, test_random_buffer_threads);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("pbkdf2");
   tcase_add_test(tc, test_pbkdf2_hmac_sha256);
   tcase_add_test(tc, test_pbkdf2_hmac_sha512);
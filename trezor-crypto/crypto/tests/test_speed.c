@@ -9,6 +9,7 @@
 #include <TrezorCrypto/ed25519.h"
 #include "hasher.h"
 #include "nist256p1.h"
+#include <TrezorCrypto/rand.h>
 #include <TrezorCrypto/secp256k1.h>
 
 uint8_t msg[256];
@@ -199,6 +200,28 @@ void bench_ckd_optimized(int iterations) {
   }
 }
 
+void bench_random32(int iterations) {
+  uint32_t acc = 0;
+  for (int i = 0; i < iterations; i++) {
+    acc ^= random32();
+  }
+  msg[0] ^= (uint8_t)acc;
+}
+
+void bench_random_buffer_32(int iterations) {
+  for (int i = 0; i < iterations; i++) {
+    random_buffer(msg, 32);
+  }
+}
+
+void bench_random_buffer_4096(int iterations) {
+  uint8_t buf[4096];
+  for (int i = 0; i < iterations; i++) {
+    random_buffer(buf, sizeof(buf));
+  }
+  msg[0] ^= buf[0];
+}
+
 void bench(void (*func)(int), const char *name, int iterations) {
   clock_t t = clock();
   func(iterations);
@@ -229,5 +252,9 @@ int main(void) {
   BENCH(bench_ckd_normal, 1000);
   BENCH(bench_ckd_optimized, 1000);
 
+  BENCH(bench_random32, 1000000);
+  BENCH(bench_random_buffer_32, 100000);
+  BENCH(bench_random_buffer_4096, 1000);
+
   return 0;
 }